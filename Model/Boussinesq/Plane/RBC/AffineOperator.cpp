@@ -0,0 +1,91 @@
+/**
+ * @file AffineOperator.cpp
+ * @brief Source of the decomposition of a per-mode operator in powers of the
+ * squared wave number
+ */
+
+// System includes
+//
+#include <algorithm>
+#include <stdexcept>
+
+// Project includes
+//
+#include "Model/Boussinesq/Plane/RBC/AffineOperator.hpp"
+
+namespace QuICC {
+
+namespace Model {
+
+namespace Boussinesq {
+
+namespace Plane {
+
+namespace RBC {
+
+AffineOperator::AffineOperator(const std::vector<SparseMatrix>& components) :
+    mDegree(static_cast<int>(components.size()) - 1)
+{
+   if (components.empty())
+   {
+      throw std::logic_error("Affine operator needs at least one component");
+   }
+
+   // Union of the patterns, explicit zeros are kept by the sum
+   this->mPattern = components.front();
+   for (std::size_t p = 1; p < components.size(); ++p)
+   {
+      if (components.at(p).rows() != this->mPattern.rows() ||
+          components.at(p).cols() != this->mPattern.cols())
+      {
+         throw std::logic_error("Affine operator components differ in size");
+      }
+      this->mPattern = this->mPattern + components.at(p);
+   }
+   this->mPattern.makeCompressed();
+   const int nnz = this->mPattern.nonZeros();
+   std::fill(this->mPattern.valuePtr(), this->mPattern.valuePtr() + nnz, 0.0);
+
+   // Components on the common pattern
+   this->mValues.resize(nnz, this->mDegree + 1);
+   for (int p = 0; p <= this->mDegree; ++p)
+   {
+      SparseMatrix aligned = this->mPattern + components.at(p);
+      aligned.makeCompressed();
+      this->mValues.col(p) = Eigen::Map<const Array>(aligned.valuePtr(), nnz);
+   }
+}
+
+SparseMatrix AffineOperator::mat(const MHDFloat kk, const MHDFloat scale) const
+{
+   // Weights of the components
+   Array w(this->mDegree + 1);
+   w(0) = scale;
+   for (int p = 1; p <= this->mDegree; ++p)
+   {
+      w(p) = w(p - 1) * kk;
+   }
+
+   SparseMatrix m = this->mPattern;
+   Eigen::Map<Array> values(m.valuePtr(), m.nonZeros());
+   values.noalias() = this->mValues * w;
+   m.prune([](const int, const int, const MHDFloat v) { return v != 0.0; });
+
+   return m;
+}
+
+int AffineOperator::degree() const
+{
+   return this->mDegree;
+}
+
+int AffineOperator::nonZeros() const
+{
+   return this->mPattern.nonZeros();
+}
+
+} // namespace RBC
+} // namespace Plane
+} // namespace Boussinesq
+} // namespace Model
+} // namespace QuICC
@@ -0,0 +1,90 @@
+/**
+ * @file AffineOperator.hpp
+ * @brief Decomposition of a per-mode operator into k-independent components
+ * weighted by powers of the squared wave number
+ */
+
+#ifndef QUICC_MODEL_BOUSSINESQ_PLANE_RBC_AFFINEOPERATOR_HPP
+#define QUICC_MODEL_BOUSSINESQ_PLANE_RBC_AFFINEOPERATOR_HPP
+
+// System includes
+//
+#include <vector>
+
+// Project includes
+//
+#include "Types/Typedefs.hpp"
+
+namespace QuICC {
+
+namespace Model {
+
+namespace Boussinesq {
+
+namespace Plane {
+
+namespace RBC {
+
+/**
+ * @brief Decomposition of a per-mode operator into k-independent components
+ * weighted by powers of the squared wave number
+ *
+ * The operators of the plane layer only depend on the horizontal wave
+ * numbers through \f$ k^2 = k_1^2 + k_2^2 \f$ and are polynomials in it,
+ * e.g. \f$ -k^2 I_2 \Delta = -k^2 I_2 D^2 + k^4 I_2 \f$. The
+ * k-independent components \f$ A_p \f$ are stored once as value arrays on
+ * the union of their sparsity patterns. The operator of a mode,
+ * \f$ \sum_p k^{2p} A_p \f$, is then assembled in a single pass over the
+ * values, without building any quasi-inverse operator. Entries cancelling
+ * for a given wave number, e.g. all of them for the mean mode of an
+ * operator scaled by \f$ k^2 \f$, are pruned.
+ */
+class AffineOperator
+{
+public:
+   /**
+    * @brief Constructor
+    *
+    * @param components Components A_p of the powers k^(2p), same size
+    */
+   explicit AffineOperator(const std::vector<SparseMatrix>& components);
+
+   /**
+    * @brief Destructor
+    */
+   ~AffineOperator() = default;
+
+   /**
+    * @brief Operator of a mode, without zero entries
+    *
+    * @param kk      Squared wave number k1^2 + k2^2
+    * @param scale   Scaling of the operator
+    */
+   SparseMatrix mat(const MHDFloat kk, const MHDFloat scale = 1.0) const;
+
+   /**
+    * @brief Degree in k^2
+    */
+   int degree() const;
+
+   /**
+    * @brief Number of nonzeros of the common pattern
+    */
+   int nonZeros() const;
+
+private:
+   /// Degree in k^2
+   int mDegree;
+   /// Common pattern of the components, zero values
+   SparseMatrix mPattern;
+   /// Values of the components, one column per power of k^2
+   Matrix mValues;
+};
+
+} // namespace RBC
+} // namespace Plane
+} // namespace Boussinesq
+} // namespace Model
+} // namespace QuICC
+
+#endif // QUICC_MODEL_BOUSSINESQ_PLANE_RBC_AFFINEOPERATOR_HPP
@@ -0,0 +1,146 @@
+/**
+ * @file CounterRng.hpp
+ * @brief Counter-based random number generator
+ */
+
+#ifndef QUICC_MODEL_BOUSSINESQ_PLANE_RBC_COUNTERRNG_HPP
+#define QUICC_MODEL_BOUSSINESQ_PLANE_RBC_COUNTERRNG_HPP
+
+// System includes
+//
+#include <cassert>
+#include <cstdint>
+
+// Project includes
+//
+
+namespace QuICC {
+
+namespace Model {
+
+namespace Boussinesq {
+
+namespace Plane {
+
+namespace RBC {
+
+/**
+ * @brief Counter-based random number generator
+ *
+ * The generated value is a pure function of (seed, stream, counter). There is
+ * no internal state, values can therefore be generated in any order and on
+ * any rank and are reproducible independently of the data distribution. The
+ * mixing function is the SplitMix64 finalizer applied to a Weyl sequence.
+ */
+class CounterRng
+{
+public:
+   /**
+    * @brief Constructor
+    *
+    * @param seed    Seed of the generator
+    * @param stream  Independent stream ID (field component, ...)
+    */
+   CounterRng(const std::uint64_t seed, const std::uint64_t stream) :
+       mKey(mix(seed + mix(stream + cGamma)))
+   {}
+
+   /**
+    * @brief Destructor
+    */
+   ~CounterRng() = default;
+
+   /**
+    * @brief Random 64 bit integer for counter
+    *
+    * @param counter Counter
+    */
+   std::uint64_t bits(const std::uint64_t counter) const
+   {
+      return mix(this->mKey ^ mix((counter + 1) * cGamma));
+   }
+
+   /**
+    * @brief Uniform random value in [0, 1)
+    *
+    * @param counter Counter
+    */
+   double uniform(const std::uint64_t counter) const
+   {
+      // Use upper 53 bits to fill mantissa
+      return static_cast<double>(this->bits(counter) >> 11) * 0x1.0p-53;
+   }
+
+   /**
+    * @brief Uniform random value in [minVal, maxVal)
+    *
+    * @param counter Counter
+    * @param minVal  Lower bound
+    * @param maxVal  Upper bound
+    */
+   double uniform(const std::uint64_t counter, const double minVal,
+      const double maxVal) const
+   {
+      return minVal + (maxVal - minVal) * this->uniform(counter);
+   }
+
+   /**
+    * @brief Build counter from 3D spectral index and real/imaginary part
+    *
+    * @param n    Index of first dimension
+    * @param j    Index of second dimension
+    * @param k    Index of third dimension
+    * @param part 0 for real part, 1 for imaginary part
+    */
+   static std::uint64_t counter(const std::uint64_t n, const std::uint64_t j,
+      const std::uint64_t k, const std::uint64_t part)
+   {
+      assert(n < cIndexLimit);
+      assert(j < cIndexLimit);
+      assert(k < cIndexLimit);
+      assert(part < 2);
+
+      return (((k << cIndexBits | j) << cIndexBits | n) << 1) | part;
+   }
+
+   /**
+    * @brief Bits per spectral index in the counter
+    */
+   static constexpr int cIndexBits = 20;
+
+   /**
+    * @brief Exclusive upper limit of a spectral index in the counter
+    */
+   static constexpr std::uint64_t cIndexLimit = std::uint64_t(1) << cIndexBits;
+
+private:
+   /**
+    * @brief Weyl sequence increment (golden ratio)
+    */
+   static constexpr std::uint64_t cGamma = 0x9e3779b97f4a7c15ULL;
+
+   /**
+    * @brief SplitMix64 finalizer
+    *
+    * @param z Value to mix
+    */
+   static std::uint64_t mix(std::uint64_t z)
+   {
+      z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+      z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+      return z ^ (z >> 31);
+   }
+
+   /**
+    * @brief Key derived from seed and stream
+    */
+   std::uint64_t mKey;
+};
+
+} // namespace RBC
+} // namespace Plane
+} // namespace Boussinesq
+} // namespace Model
+} // namespace QuICC
+
+#endif // QUICC_MODEL_BOUSSINESQ_PLANE_RBC_COUNTERRNG_HPP
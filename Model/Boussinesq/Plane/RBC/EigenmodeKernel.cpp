@@ -0,0 +1,319 @@
+/**
+ * @file EigenmodeKernel.cpp
+ * @brief Source of spectral kernel generating a superposition of linear
+ * eigenmodes
+ */
+
+// System includes
+//
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+#ifdef QUICC_MPI
+#include <mpi.h>
+#endif // QUICC_MPI
+
+// Project includes
+//
+#include "Model/Boussinesq/Plane/RBC/CounterRng.hpp"
+#include "Model/Boussinesq/Plane/RBC/EigenmodeKernel.hpp"
+#include "Model/Boussinesq/Plane/RBC/StateResampler.hpp"
+#include "QuICC/Math/Constants.hpp"
+#include "QuICC/Resolutions/Resolution.hpp"
+
+namespace QuICC {
+
+namespace Model {
+
+namespace Boussinesq {
+
+namespace Plane {
+
+namespace RBC {
+
+EigenmodeKernel::EigenmodeKernel(const bool isComplex) :
+    ISpectralKernel(isComplex),
+    mNModes(1),
+    mMaxIndex(1),
+    mMaxShells(1),
+    mAmplitude(1.0),
+    mSeed(1),
+    mComp(FieldComponents::Spectral::SCALAR),
+    mspModes(std::make_shared<ModeMap>())
+{}
+
+void EigenmodeKernel::init(std::shared_ptr<LinearStability> spStability,
+   const int nModes, const int maxIndex, const int maxShells,
+   const MHDFloat amplitude, const std::uint64_t seed, const Resolution& res)
+{
+   assert(spStability);
+   assert(nModes > 0);
+   assert(maxIndex > 0);
+   assert(maxShells > 0);
+
+   this->mspStability = spStability;
+   this->mNModes = nModes;
+   this->mMaxIndex = maxIndex;
+   this->mMaxShells = maxShells;
+   this->mAmplitude = amplitude;
+   this->mSeed = seed;
+
+   int rank = 0;
+#ifdef QUICC_MPI
+   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif // QUICC_MPI
+
+   // All ranks reach the broadcast, also if the selection failed
+   ModeMap modes;
+   std::string error;
+   if (rank == 0)
+   {
+      try
+      {
+         modes = this->select(res);
+      }
+      catch (const std::exception& e)
+      {
+         error = e.what();
+      }
+   }
+
+   int hasFailed = !error.empty();
+#ifdef QUICC_MPI
+   MPI_Bcast(&hasFailed, 1, MPI_INT, 0, MPI_COMM_WORLD);
+#endif // QUICC_MPI
+   if (hasFailed)
+   {
+      if (error.empty())
+      {
+         error = "Eigenmode selection failed on the first rank";
+      }
+      throw std::logic_error(error);
+   }
+
+   broadcast(modes,
+      res.sim().dim(Dimensions::Simulation::SIM1D, Dimensions::Space::SPECTRAL));
+   this->mspModes = std::make_shared<const ModeMap>(std::move(modes));
+}
+
+void EigenmodeKernel::setComponent(const FieldComponents::Spectral::Id comp)
+{
+   this->mComp = comp;
+}
+
+EigenmodeKernel::ModeMap EigenmodeKernel::select(const Resolution& res) const
+{
+   const int nJ =
+      res.sim().dim(Dimensions::Simulation::SIM3D, Dimensions::Space::SPECTRAL);
+   const int nK =
+      res.sim().dim(Dimensions::Simulation::SIM2D, Dimensions::Space::SPECTRAL);
+   const MHDFloat scaleJ = res.sim().boxScale(Dimensions::Simulation::SIM3D);
+   const MHDFloat scaleK = res.sim().boxScale(Dimensions::Simulation::SIM2D);
+
+   // Eigenmodes only depend on |k|, on a square box shells are identified by
+   // the integer k_^2 + kJ^2
+   auto shellKey = [&](const int k_, const int kJ)
+   {
+      if (scaleJ == scaleK)
+      {
+         return std::make_pair(k_ * k_ + kJ * kJ, 0);
+      }
+      return std::make_pair(k_, std::abs(kJ));
+   };
+
+   std::vector<std::tuple<int, int>> indexes;
+   std::map<std::pair<int, int>, std::pair<MHDComplex, Mode>> shells;
+   for (int k_ = 0; k_ < std::min(nK, this->mMaxIndex + 1); ++k_)
+   {
+      for (int j_ = 0; j_ < nJ; ++j_)
+      {
+         const int kJ = StateResampler::waveNumber(j_, nJ);
+         if (std::abs(kJ) > this->mMaxIndex || (k_ == 0 && kJ <= 0))
+         {
+            continue;
+         }
+
+         indexes.emplace_back(j_, k_);
+         shells.emplace(shellKey(k_, kJ), std::make_pair(MHDComplex(), Mode()));
+      }
+   }
+
+   if (indexes.empty())
+   {
+      throw std::logic_error("No horizontal wave number up to "
+                             "eigenmode/max_index is resolved");
+   }
+
+   if (static_cast<int>(shells.size()) > this->mMaxShells)
+   {
+      throw std::logic_error("Eigenmode scan needs " +
+                             std::to_string(shells.size()) +
+                             " eigenvalue problems, reduce eigenmode/max_index "
+                             "or increase eigenmode/max_shells");
+   }
+
+   // Growth rate of all shells
+   for (auto& sh: shells)
+   {
+      MHDFloat k1, k2;
+      if (scaleJ == scaleK)
+      {
+         k1 = scaleK * std::sqrt(static_cast<MHDFloat>(sh.first.first));
+         k2 = 0;
+      }
+      else
+      {
+         k1 = scaleK * sh.first.first;
+         k2 = scaleJ * sh.first.second;
+      }
+      auto& m = sh.second.second;
+      sh.second.first = this->mspStability->fastest(m.first, m.second, k1, k2);
+   }
+
+   std::vector<std::tuple<MHDFloat, int, int>> candidates;
+   for (const auto& idx: indexes)
+   {
+      const int j_ = std::get<0>(idx);
+      const int k_ = std::get<1>(idx);
+      const int kJ = StateResampler::waveNumber(j_, nJ);
+      candidates.emplace_back(shells.at(shellKey(k_, kJ)).first.real(), j_,
+         k_);
+   }
+
+   // Fastest modes first, ties are broken by the indexes to stay
+   // deterministic
+   std::sort(candidates.begin(), candidates.end(),
+      [](const auto& a, const auto& b)
+      {
+         if (std::get<0>(a) != std::get<0>(b))
+         {
+            return std::get<0>(a) > std::get<0>(b);
+         }
+         return std::make_pair(std::get<2>(a), std::get<1>(a)) <
+                std::make_pair(std::get<2>(b), std::get<1>(b));
+      });
+
+   using Rng = CounterRng;
+   ModeMap modes;
+   Rng rng(this->mSeed, 3);
+   const int nSel =
+      std::min(this->mNModes, static_cast<int>(candidates.size()));
+   for (int s = 0; s < nSel; ++s)
+   {
+      const int j_ = std::get<1>(candidates.at(s));
+      const int k_ = std::get<2>(candidates.at(s));
+      const int kJ = StateResampler::waveNumber(j_, nJ);
+      const auto& m = shells.at(shellKey(k_, kJ)).second;
+
+      const MHDFloat phi =
+         2.0 * Math::PI * rng.uniform(Rng::counter(0, j_, k_, 0));
+      const MHDComplex c = this->mAmplitude * std::polar(1.0, phi);
+      modes.emplace(std::make_pair(j_, k_),
+         std::make_pair(c * m.first, c * m.second));
+
+      // Complex conjugate on the k = 0 plane to generate a real field
+      if (k_ == 0)
+      {
+         modes.emplace(std::make_pair(nJ - j_, k_),
+            std::make_pair(std::conj(c) * m.first.conjugate(),
+               std::conj(c) * m.second.conjugate()));
+      }
+   }
+
+   return modes;
+}
+
+void EigenmodeKernel::broadcast(ModeMap& modes, const int nN)
+{
+#ifdef QUICC_MPI
+   int rank = 0;
+   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+   int nModes = modes.size();
+   MPI_Bcast(&nModes, 1, MPI_INT, 0, MPI_COMM_WORLD);
+
+   // Fourier indexes and poloidal/temperature expansions of each mode
+   std::vector<int> idx(2 * nModes);
+   std::vector<MHDComplex> data(2 * nModes * nN);
+   if (rank == 0)
+   {
+      int m = 0;
+      for (const auto& mode: modes)
+      {
+         idx.at(2 * m) = mode.first.first;
+         idx.at(2 * m + 1) = mode.first.second;
+         Eigen::Map<ArrayZ>(data.data() + 2 * m * nN, nN) = mode.second.first;
+         Eigen::Map<ArrayZ>(data.data() + (2 * m + 1) * nN, nN) =
+            mode.second.second;
+         ++m;
+      }
+   }
+   MPI_Bcast(idx.data(), idx.size(), MPI_INT, 0, MPI_COMM_WORLD);
+   MPI_Bcast(data.data(), 2 * data.size(), MPI_DOUBLE, 0, MPI_COMM_WORLD);
+
+   if (rank != 0)
+   {
+      modes.clear();
+      for (int m = 0; m < nModes; ++m)
+      {
+         modes.emplace(std::make_pair(idx.at(2 * m), idx.at(2 * m + 1)),
+            std::make_pair(
+               ArrayZ(Eigen::Map<ArrayZ>(data.data() + 2 * m * nN, nN)),
+               ArrayZ(Eigen::Map<ArrayZ>(data.data() + (2 * m + 1) * nN, nN))));
+      }
+   }
+#else
+   (void)modes;
+   (void)nN;
+#endif // QUICC_MPI
+}
+
+MHDVariant EigenmodeKernel::compute(const int i, const int j,
+   const int k) const
+{
+   MHDComplex val = 0.0;
+
+   // Toroidal component is not excited by the buoyancy
+   if (this->mComp != FieldComponents::Spectral::TOR)
+   {
+      const auto& tRes =
+         *this->res().cpu()->dim(Dimensions::Transform::SPECTRAL);
+
+      // Global spectral indexes
+      const int n = tRes.idx<Dimensions::Data::DAT1D>(i, k);
+      const int j_ = tRes.idx<Dimensions::Data::DAT2D>(j, k);
+      const int k_ = tRes.idx<Dimensions::Data::DAT3D>(k);
+
+      auto it = this->mspModes->find(std::make_pair(j_, k_));
+      if (it != this->mspModes->end())
+      {
+         if (this->mComp == FieldComponents::Spectral::POL)
+         {
+            val = it->second.first(n);
+         }
+         else
+         {
+            val = it->second.second(n);
+         }
+      }
+   }
+
+   if (this->mIsComplex)
+   {
+      return val;
+   }
+   else
+   {
+      return val.real();
+   }
+}
+
+} // namespace RBC
+} // namespace Plane
+} // namespace Boussinesq
+} // namespace Model
+} // namespace QuICC
@@ -0,0 +1,173 @@
+/**
+ * @file EigenmodeKernel.hpp
+ * @brief Spectral kernel generating a superposition of linear eigenmodes
+ */
+
+#ifndef QUICC_MODEL_BOUSSINESQ_PLANE_RBC_EIGENMODEKERNEL_HPP
+#define QUICC_MODEL_BOUSSINESQ_PLANE_RBC_EIGENMODEKERNEL_HPP
+
+// System includes
+//
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <utility>
+
+// Project includes
+//
+#include "Model/Boussinesq/Plane/RBC/LinearStability.hpp"
+#include "QuICC/Enums/FieldIds.hpp"
+#include "QuICC/Resolutions/Resolution.hpp"
+#include "QuICC/SpectralKernels/ISpectralKernel.hpp"
+
+namespace QuICC {
+
+namespace Model {
+
+namespace Boussinesq {
+
+namespace Plane {
+
+namespace RBC {
+
+/**
+ * @brief Spectral kernel generating a superposition of linear eigenmodes
+ *
+ * The fastest growing eigenmodes of the conduction state are computed for
+ * all horizontal wave numbers up to a maximum index and the fastest ones are
+ * superposed with random phases. The eigenmodes only depend on the magnitude
+ * of the wave number, each shell is solved once. The selection is done by
+ * init on the first rank and broadcast to all ranks, compute only looks up
+ * the result. Copies of the kernel share the selected modes, such that the
+ * temperature and the velocity components are initialized with the same
+ * eigenmodes.
+ */
+class EigenmodeKernel : public Spectral::Kernel::ISpectralKernel
+{
+public:
+   /**
+    * @brief Simple constructor
+    *
+    * @param isComplex  Spectrum is complex?
+    */
+   explicit EigenmodeKernel(const bool isComplex);
+
+   /**
+    * @brief Simple empty destructor
+    */
+   virtual ~EigenmodeKernel() = default;
+
+   /**
+    * @brief Initialize kernel and select the eigenmodes
+    *
+    * Collective over all ranks. Throws if the scan needs more than maxShells
+    * eigenvalue problems or if no eigenmode is found.
+    *
+    * @param spStability   Linear stability problem
+    * @param nModes        Number of superposed eigenmodes
+    * @param maxIndex      Maximum horizontal wave index
+    * @param maxShells     Maximum number of solved wave number shells
+    * @param amplitude     Maximum temperature coefficient of each mode
+    * @param seed          Seed of the random phases
+    * @param res           Resolution of the generated state
+    */
+   void init(std::shared_ptr<LinearStability> spStability, const int nModes,
+      const int maxIndex, const int maxShells, const MHDFloat amplitude,
+      const std::uint64_t seed, const Resolution& res);
+
+   /**
+    * @brief Set generated field component
+    *
+    * @param comp Spectral component (TOR, POL or SCALAR)
+    */
+   void setComponent(const FieldComponents::Spectral::Id comp);
+
+   /**
+    * @brief Compute the spectral kernel
+    *
+    * @param i Fast index
+    * @param j Middle index
+    * @param k Slow index
+    */
+   virtual MHDVariant compute(const int i, const int j,
+      const int k) const override;
+
+protected:
+private:
+   /**
+    * @brief Poloidal and temperature expansion of a mode
+    */
+   typedef std::pair<ArrayZ, ArrayZ> Mode;
+
+   /**
+    * @brief Selected modes indexed by global (complex, real-to-complex)
+    * Fourier indexes
+    */
+   typedef std::map<std::pair<int, int>, Mode> ModeMap;
+
+   /**
+    * @brief Compute and select the fastest growing modes
+    *
+    * @param res  Resolution of the generated state
+    */
+   ModeMap select(const Resolution& res) const;
+
+   /**
+    * @brief Broadcast selected modes from the first rank
+    *
+    * @param modes   Selected modes, only valid on the first rank on input
+    * @param nN      Size of Chebyshev expansion
+    */
+   static void broadcast(ModeMap& modes, const int nN);
+
+   /**
+    * @brief Linear stability problem
+    */
+   std::shared_ptr<LinearStability> mspStability;
+
+   /**
+    * @brief Number of superposed eigenmodes
+    */
+   int mNModes;
+
+   /**
+    * @brief Maximum horizontal wave index
+    */
+   int mMaxIndex;
+
+   /**
+    * @brief Maximum number of solved wave number shells
+    */
+   int mMaxShells;
+
+   /**
+    * @brief Amplitude of each mode
+    */
+   MHDFloat mAmplitude;
+
+   /**
+    * @brief Seed of the random phases
+    */
+   std::uint64_t mSeed;
+
+   /**
+    * @brief Generated field component
+    */
+   FieldComponents::Spectral::Id mComp;
+
+   /**
+    * @brief Selected modes, shared between copies
+    */
+   std::shared_ptr<const ModeMap> mspModes;
+};
+
+/// Typedef for a smart EigenmodeKernel
+typedef std::shared_ptr<EigenmodeKernel> SharedEigenmodeKernel;
+
+} // namespace RBC
+} // namespace Plane
+} // namespace Boussinesq
+} // namespace Model
+} // namespace QuICC
+
+#endif // QUICC_MODEL_BOUSSINESQ_PLANE_RBC_EIGENMODEKERNEL_HPP
@@ -6,6 +6,8 @@
 // System includes
 //
 #include <stdexcept>
+#include <string>
+#include <vector>
 
 // Project includes
 //
@@ -59,14 +61,53 @@ namespace RBC {
 
 namespace Explicit {
 
-ModelBackend::ModelBackend() :
-    IRBCBackend(),
-#ifdef QUICC_TRANSFORM_CHEBYSHEV_TRUNCATE_QI
-    mcTruncateQI(true)
-#else
-    mcTruncateQI(false)
-#endif // QUICC_TRANSFORM_CHEBYSHEV_TRUNCATE_QI
-{}
+namespace {
+
+/**
+ * @brief Components of laplh I2 Lapl = -k^2 I2 D^2 + k^4 I2
+ *
+ * @param o    Block options
+ * @param nNr  Number of rows
+ * @param nNc  Number of columns
+ */
+std::vector<SparseMatrix> laplhI2LaplComponents(
+   const implDetails::BlockOptionsImpl& o, const int nNr, const int nNc)
+{
+   SparseSM::Chebyshev::LinearMap::I2Lapl i2d2(nNr, nNc, o.zi, o.zo, 0, 0);
+   SparseSM::Chebyshev::LinearMap::I2 i2(nNr, nNc, o.zi, o.zo);
+
+   return {SparseMatrix(nNr, nNc), -i2d2.mat(), i2.mat()};
+}
+
+/**
+ * @brief Single k-independent component of I2
+ *
+ * @param o    Block options
+ * @param nNr  Number of rows
+ * @param nNc  Number of columns
+ */
+std::vector<SparseMatrix> i2Components(const implDetails::BlockOptionsImpl& o,
+   const int nNr, const int nNc)
+{
+   SparseSM::Chebyshev::LinearMap::I2 i2(nNr, nNc, o.zi, o.zo);
+
+   return {i2.mat()};
+}
+
+} // namespace
+
+ModelBackend::ModelBackend() : IRBCBackend() {}
+
+SparseMatrix ModelBackend::affineBlock(const implDetails::BlockOptionsImpl& o,
+   const std::string& name, const int nNr, const int nNc,
+   const ComponentsBuilder& components, const MHDFloat scale)
+{
+   const IRBCBackend::AffineKey key(name, nNr, nNc, o.zi, o.zo, o.bcId,
+      o.dropQIColumns);
+
+   return o.pBackend->affineOperator(key, components)
+      .mat(o.k1 * o.k1 + o.k2 * o.k2, scale);
+}
 
 bool ModelBackend::isComplex(const SpectralFieldId& fId) const
 {
@@ -87,6 +128,12 @@ ModelBackend::SpectralFieldIds ModelBackend::implicitFields(
    return fields;
 }
 
+ModelBackend::SpectralFieldIds ModelBackend::explicitLinearFields(
+   const SpectralFieldId& fId) const
+{
+   return SpectralFieldIds();
+}
+
 ModelBackend::SpectralFieldIds ModelBackend::explicitNonlinearFields(
    const SpectralFieldId& fId) const
 {
@@ -122,7 +169,7 @@ void ModelBackend::equationInfo(EquationInfo& info, const SpectralFieldId& fId,
    info.im = this->implicitFields(fId);
 
    // Explicit linear terms
-   info.exL.clear();
+   info.exL = this->explicitLinearFields(fId);
 
    // Explicit nonlinear terms
    info.exNL = this->explicitNonlinearFields(fId);
@@ -188,9 +235,11 @@ std::vector<details::BlockDescription> ModelBackend::implicitBlockBuilder(
       opts->k1 = eigs.at(0);
       opts->k2 = eigs.at(1);
       opts->bcId = bcs.find(colId.first)->second;
-      opts->truncateQI = this->mcTruncateQI;
+      opts->truncateQI = this->truncateQI();
+      opts->dropQIColumns = this->dropQIColumns();
       opts->isSplitOperator = isSplitOperator;
       opts->useSplitEquation = this->useSplitEquation();
+      opts->pBackend = this;
       d.opts = opts;
 
       return d;
@@ -219,10 +268,8 @@ std::vector<details::BlockDescription> ModelBackend::implicitBlockBuilder(
             }
             else
             {
-               auto laplh = -(o.k1 * o.k1 + o.k2 * o.k2);
-               SparseSM::Chebyshev::LinearMap::I2Lapl spasm(nNr, nNc, o.zi,
-                  o.zo, o.k1, o.k2);
-               bMat = laplh * spasm.mat();
+               bMat = affineBlock(o, "laplh_I2Lapl", nNr, nNc,
+                  [&]() { return laplhI2LaplComponents(o, nNr, nNc); });
             }
 
             return bMat;
@@ -250,20 +297,17 @@ std::vector<details::BlockDescription> ModelBackend::implicitBlockBuilder(
 
             auto& o =
                *std::dynamic_pointer_cast<implDetails::BlockOptionsImpl>(opts);
-            auto laplh = -(o.k1 * o.k1 + o.k2 * o.k2);
             if (o.useSplitEquation)
             {
                if (o.isSplitOperator)
                {
-                  SparseSM::Chebyshev::LinearMap::I2Lapl spasm(nNr, nNc, o.zi,
-                     o.zo, o.k1, o.k2);
-                  bMat = laplh * spasm.mat();
+                  bMat = affineBlock(o, "laplh_I2Lapl", nNr, nNc,
+                     [&]() { return laplhI2LaplComponents(o, nNr, nNc); });
                }
                else
                {
-                  SparseSM::Chebyshev::LinearMap::I2Lapl spasm(nNr, nNc, o.zi,
-                     o.zo, o.k1, o.k2);
-                  bMat = laplh * spasm.mat();
+                  bMat = affineBlock(o, "laplh_I2Lapl", nNr, nNc,
+                     [&]() { return laplhI2LaplComponents(o, nNr, nNc); });
                }
             }
             else
@@ -276,9 +320,17 @@ std::vector<details::BlockDescription> ModelBackend::implicitBlockBuilder(
                }
                else
                {
-                  SparseSM::Chebyshev::LinearMap::I4Lapl2 spasm(nNr, nNc, o.zi,
-                     o.zo, o.k1, o.k2);
-                  bMat = laplh * spasm.mat();
+                  // laplh I4 Lapl2 = -k^2 I4 D^4 + 2 k^4 I4 D^2 - k^6 I4
+                  auto components = [&]() -> std::vector<SparseMatrix>
+                  {
+                     namespace LinearMap = SparseSM::Chebyshev::LinearMap;
+                     LinearMap::I4Lapl2 i4d4(nNr, nNc, o.zi, o.zo, 0, 0);
+                     LinearMap::I4Lapl i4d2(nNr, nNc, o.zi, o.zo, 0, 0);
+                     LinearMap::I4 i4(nNr, nNc, o.zi, o.zo);
+                     return {SparseMatrix(nNr, nNc), -i4d4.mat(),
+                        2.0 * i4d2.mat(), -i4.mat()};
+                  };
+                  bMat = affineBlock(o, "laplh_I4Lapl2", nNr, nNc, components);
                }
             }
 
@@ -307,9 +359,14 @@ std::vector<details::BlockDescription> ModelBackend::implicitBlockBuilder(
             auto Ra = nds.find(NonDimensional::Rayleigh::id())->second->value();
             auto Pr = nds.find(NonDimensional::Prandtl::id())->second->value();
 
-            auto laplh = -(o.k1 * o.k1 + o.k2 * o.k2);
-            SparseSM::Chebyshev::LinearMap::I4 spasm(nNr, nNc, o.zi, o.zo);
-            bMat = -(Ra / Pr) * laplh * spasm.mat();
+            // laplh I4 = -k^2 I4
+            auto components = [&]() -> std::vector<SparseMatrix>
+            {
+               SparseSM::Chebyshev::LinearMap::I4 i4(nNr, nNc, o.zi, o.zo);
+               return {SparseMatrix(nNr, nNc), -i4.mat()};
+            };
+            bMat =
+               affineBlock(o, "laplh_I4", nNr, nNc, components, -(Ra / Pr));
 
             return bMat;
          };
@@ -348,9 +405,15 @@ std::vector<details::BlockDescription> ModelBackend::implicitBlockBuilder(
             }
             else
             {
-               SparseSM::Chebyshev::LinearMap::I2Lapl spasm(nNr, nNc, o.zi,
-                  o.zo, o.k1, o.k2);
-               bMat = (1.0 / Pr) * spasm.mat();
+               // I2 Lapl = I2 D^2 - k^2 I2
+               auto components = [&]() -> std::vector<SparseMatrix>
+               {
+                  namespace LinearMap = SparseSM::Chebyshev::LinearMap;
+                  LinearMap::I2Lapl i2d2(nNr, nNc, o.zi, o.zo, 0, 0);
+                  LinearMap::I2 i2(nNr, nNc, o.zi, o.zo);
+                  return {i2d2.mat(), -i2.mat()};
+               };
+               bMat = affineBlock(o, "I2Lapl", nNr, nNc, components, 1.0 / Pr);
             }
 
             return bMat;
@@ -397,9 +460,11 @@ std::vector<details::BlockDescription> ModelBackend::timeBlockBuilder(
       opts->k1 = eigs.at(0);
       opts->k2 = eigs.at(1);
       opts->bcId = bcs.find(colId.first)->second;
-      opts->truncateQI = this->mcTruncateQI;
+      opts->truncateQI = this->truncateQI();
+      opts->dropQIColumns = this->dropQIColumns();
       opts->isSplitOperator = false;
       opts->useSplitEquation = this->useSplitEquation();
+      opts->pBackend = this;
       d.opts = opts;
 
       return d;
@@ -426,9 +491,13 @@ std::vector<details::BlockDescription> ModelBackend::timeBlockBuilder(
          }
          else
          {
-            auto laplh = -(o.k1 * o.k1 + o.k2 * o.k2);
-            SparseSM::Chebyshev::LinearMap::I2 spasm(nNr, nNc, o.zi, o.zo);
-            bMat = laplh * spasm.mat();
+            // laplh I2 = -k^2 I2
+            auto components = [&]() -> std::vector<SparseMatrix>
+            {
+               SparseSM::Chebyshev::LinearMap::I2 i2(nNr, nNc, o.zi, o.zo);
+               return {SparseMatrix(nNr, nNc), -i2.mat()};
+            };
+            bMat = affineBlock(o, "laplh_I2", nNr, nNc, components);
          }
 
          return bMat;
@@ -457,8 +526,8 @@ std::vector<details::BlockDescription> ModelBackend::timeBlockBuilder(
 
          if (o.useSplitEquation)
          {
-            SparseSM::Chebyshev::LinearMap::I2 spasm(nNr, nNc, o.zi, o.zo);
-            bMat = spasm.mat();
+            bMat = affineBlock(o, "I2", nNr, nNc,
+               [&]() { return i2Components(o, nNr, nNc); });
          }
          else
          {
@@ -469,29 +538,32 @@ std::vector<details::BlockDescription> ModelBackend::timeBlockBuilder(
             }
             else
             {
-               auto laplh = -(o.k1 * o.k1 + o.k2 * o.k2);
-               SparseSM::Chebyshev::LinearMap::I4Lapl spasm(nNr, nNc, o.zi,
-                  o.zo, o.k1, o.k2);
-
-#if 0
-               // Correct Laplacian for 4th order system according to:
-               // McFadden,Murray,Boisvert,
-               // Elimination of Spurious Eigenvalues in the
-               // Chebyshev Tau Spectral Method,
-               // JCP 91, 228-239 (1990)
-               // We simply drop the last two column
-               if (o.bcId == Bc::Name::NoSlip::id())
-               {
-                  SparseSM::Chebyshev::LinearMap::Id qid(nNr, nNc, o.zi, o.zo, -2);
-                  bMat = laplh * spasm.mat() * qid.mat();
-               }
-               else
+               // laplh I4 Lapl = -k^2 I4 D^2 + k^4 I4
+               auto components = [&]() -> std::vector<SparseMatrix>
                {
-                  bMat = laplh * spasm.mat();
-               }
-#else
-               bMat = laplh * spasm.mat();
-#endif
+                  namespace LinearMap = SparseSM::Chebyshev::LinearMap;
+                  LinearMap::I4Lapl i4d2(nNr, nNc, o.zi, o.zo, 0, 0);
+                  LinearMap::I4 i4(nNr, nNc, o.zi, o.zo);
+                  std::vector<SparseMatrix> c = {SparseMatrix(nNr, nNc),
+                     -i4d2.mat(), i4.mat()};
+
+                  // Optionally correct the Laplacian for the 4th order system
+                  // according to:
+                  // McFadden,Murray,Boisvert,
+                  // Elimination of Spurious Eigenvalues in the
+                  // Chebyshev Tau Spectral Method,
+                  // JCP 91, 228-239 (1990)
+                  // We simply drop the last two column
+                  if (o.dropQIColumns && o.bcId == Bc::Name::NoSlip::id())
+                  {
+                     LinearMap::Id qid(nNr, nNc, o.zi, o.zo, -2);
+                     c.at(1) = c.at(1) * qid.mat();
+                     c.at(2) = c.at(2) * qid.mat();
+                  }
+
+                  return c;
+               };
+               bMat = affineBlock(o, "laplh_I4Lapl", nNr, nNc, components);
             }
          }
 
@@ -516,17 +588,8 @@ std::vector<details::BlockDescription> ModelBackend::timeBlockBuilder(
          auto& o =
             *std::dynamic_pointer_cast<implDetails::BlockOptionsImpl>(opts);
 
-         SparseMatrix bMat;
-         if (o.k1 == 0 && o.k2 == 0)
-         {
-            SparseSM::Chebyshev::LinearMap::I2 spasm(nNr, nNc, o.zi, o.zo);
-            bMat = spasm.mat();
-         }
-         else
-         {
-            SparseSM::Chebyshev::LinearMap::I2 spasm(nNr, nNc, o.zi, o.zo);
-            bMat = spasm.mat();
-         }
+         SparseMatrix bMat = affineBlock(o, "I2", nNr, nNc,
+            [&]() { return i2Components(o, nNr, nNc); });
 
          return bMat;
       };
@@ -560,7 +623,8 @@ std::vector<details::BlockDescription> ModelBackend::boundaryBlockBuilder(
       opts->k1 = eigs.at(0);
       opts->k2 = eigs.at(1);
       opts->bcId = bcs.find(colId.first)->second;
-      opts->truncateQI = this->mcTruncateQI;
+      opts->truncateQI = this->truncateQI();
+      opts->dropQIColumns = this->dropQIColumns();
       opts->isSplitOperator = isSplit;
       opts->useSplitEquation = this->useSplitEquation();
       d.opts = opts;
@@ -613,7 +677,8 @@ ModelBackend::splitBoundaryValueBlockBuilder(const SpectralFieldId& rowId,
       opts->k1 = eigs.at(0);
       opts->k2 = eigs.at(1);
       opts->bcId = bcs.find(colId.first)->second;
-      opts->truncateQI = this->mcTruncateQI;
+      opts->truncateQI = this->truncateQI();
+      opts->dropQIColumns = this->dropQIColumns();
       opts->isSplitOperator = false;
       opts->useSplitEquation = this->useSplitEquation();
       d.opts = opts;
@@ -736,6 +801,8 @@ void ModelBackend::modelMatrix(DecoupledZSparse& rModelMatrix,
    {
       throw std::logic_error("Requested operator type is not implemented");
    }
+
+   this->recordOperator(rModelMatrix, opId, *imRange.first, matIdx);
 }
 
 void ModelBackend::galerkinStencil(SparseMatrix& mat,
@@ -763,7 +830,11 @@ void ModelBackend::explicitBlock(DecoupledZSparse& decMat,
    // Explicit linear operator
    if (opId == ModelOperator::ExplicitLinear::id())
    {
-      throw std::logic_error("There are no explicit linear operators");
+      const auto& fields = this->explicitLinearFields(rowId);
+      auto descr =
+         explicitLinearBlockBuilder(rowId, colId, res, eigs, bcs, nds);
+      buildBlock(decMat, descr, rowId, colId, fields, matIdx, bcType, res, k, k,
+         bcs, nds, false, true);
    }
    // Explicit nonlinear operator
    else if (opId == ModelOperator::ExplicitNonlinear::id())
@@ -779,6 +850,17 @@ void ModelBackend::explicitBlock(DecoupledZSparse& decMat,
    {
       throw std::logic_error("There are no explicit nextstep operators");
    }
+
+   this->recordOperator(decMat, opId, rowId, matIdx);
+}
+
+std::vector<details::BlockDescription>
+ModelBackend::explicitLinearBlockBuilder(const SpectralFieldId& rowId,
+   const SpectralFieldId& colId, const Resolution& res,
+   const std::vector<MHDFloat>& eigs, const BcMap& bcs,
+   const NonDimensional::NdMap& nds) const
+{
+   throw std::logic_error("There are no explicit linear operators");
 }
 
 std::vector<details::BlockDescription>
@@ -802,9 +884,11 @@ ModelBackend::explicitNonlinearBlockBuilder(const SpectralFieldId& rowId,
       opts->k1 = eigs.at(0);
       opts->k2 = eigs.at(1);
       opts->bcId = bcs.find(colId.first)->second;
-      opts->truncateQI = this->mcTruncateQI;
+      opts->truncateQI = this->truncateQI();
+      opts->dropQIColumns = this->dropQIColumns();
       opts->isSplitOperator = false;
       opts->useSplitEquation = this->useSplitEquation();
+      opts->pBackend = this;
       d.opts = opts;
 
       return d;
@@ -824,8 +908,8 @@ ModelBackend::explicitNonlinearBlockBuilder(const SpectralFieldId& rowId,
          auto& o =
             *std::dynamic_pointer_cast<implDetails::BlockOptionsImpl>(opts);
 
-         SparseSM::Chebyshev::LinearMap::I2 spasm(nNr, nNc, o.zi, o.zo);
-         bMat = spasm.mat();
+         bMat = affineBlock(o, "I2", nNr, nNc,
+            [&]() { return i2Components(o, nNr, nNc); });
 
          return bMat;
       };
@@ -136,7 +136,18 @@ protected:
     *
     * @param fId  Field ID
     */
-   SpectralFieldIds implicitFields(const SpectralFieldId& fId) const final;
+   virtual SpectralFieldIds implicitFields(
+      const SpectralFieldId& fId) const override;
+
+   /**
+    * @brief Set field coupling for explicit linear terms
+    *
+    * There are no explicit linear terms by default
+    *
+    * @param fId  Field ID
+    */
+   virtual SpectralFieldIds explicitLinearFields(
+      const SpectralFieldId& fId) const;
 
    /**
     * @brief Set field coupling for explicit Nonlinear factors
@@ -209,6 +220,23 @@ protected:
       const Resolution& res, const std::vector<MHDFloat>& eigs,
       const BcMap& bcs, const NonDimensional::NdMap& nds) const;
 
+   /**
+    * @brief Build explicit linear matrix block description
+    *
+    * There are no explicit linear operators by default
+    *
+    * @param rowId   Field ID of block matrix row
+    * @param colId   Field ID of block matrix column
+    * @param res     Resolution object
+    * @param eigs    Slow indexes
+    * @param bcs     Boundary conditions for each field
+    * @param nds     Nondimension parameters
+    */
+   virtual std::vector<details::BlockDescription> explicitLinearBlockBuilder(
+      const SpectralFieldId& rowId, const SpectralFieldId& colId,
+      const Resolution& res, const std::vector<MHDFloat>& eigs,
+      const BcMap& bcs, const NonDimensional::NdMap& nds) const;
+
    /**
     * @brief Build explicit nonlinear matrix block description
     *
@@ -224,11 +252,19 @@ protected:
       const Resolution& res, const std::vector<MHDFloat>& eigs,
       const BcMap& bcs, const NonDimensional::NdMap& nds) const;
 
-private:
    /**
-    * @brief Truncate quasi-inverse operators?
+    * @brief Block of a mode from the k-independent components of its operator
+    *
+    * @param o          Block options
+    * @param name       Name of the operator
+    * @param nNr        Number of rows
+    * @param nNc        Number of columns
+    * @param components Builder of the components of the powers of k^2
+    * @param scale      Scaling of the operator
     */
-   const bool mcTruncateQI;
+   static SparseMatrix affineBlock(const implDetails::BlockOptionsImpl& o,
+      const std::string& name, const int nNr, const int nNc,
+      const ComponentsBuilder& components, const MHDFloat scale = 1.0);
 };
 
 } // namespace Explicit
@@ -0,0 +1,141 @@
+/**
+ * @file ModelBackend.cpp
+ * @brief Source of the model backend with explicit buoyancy
+ */
+
+// System includes
+//
+#include <cassert>
+#include <memory>
+#include <stdexcept>
+
+// Project includes
+//
+#include "Model/Boussinesq/Plane/RBC/ExplicitBuoyancy/ModelBackend.hpp"
+#include "QuICC/Enums/FieldIds.hpp"
+#include "QuICC/NonDimensional/Lower1d.hpp"
+#include "QuICC/NonDimensional/Prandtl.hpp"
+#include "QuICC/NonDimensional/Rayleigh.hpp"
+#include "QuICC/NonDimensional/Upper1d.hpp"
+#include "QuICC/PhysicalNames/Temperature.hpp"
+#include "QuICC/PhysicalNames/Velocity.hpp"
+#include "QuICC/SparseSM/Chebyshev/LinearMap/I4.hpp"
+
+namespace QuICC {
+
+namespace Model {
+
+namespace Boussinesq {
+
+namespace Plane {
+
+namespace RBC {
+
+namespace ExplicitBuoyancy {
+
+ModelBackend::ModelBackend() : Explicit::ModelBackend() {}
+
+ModelBackend::SpectralFieldIds ModelBackend::implicitFields(
+   const SpectralFieldId& fId) const
+{
+   // Buoyancy is explicit: all fields are solved independently
+   SpectralFieldIds fields = {fId};
+
+   return fields;
+}
+
+ModelBackend::SpectralFieldIds ModelBackend::explicitLinearFields(
+   const SpectralFieldId& fId) const
+{
+   SpectralFieldIds fields;
+   if (fId == std::make_pair(PhysicalNames::Velocity::id(),
+                 FieldComponents::Spectral::POL))
+   {
+      fields.push_back(std::make_pair(PhysicalNames::Temperature::id(),
+         FieldComponents::Spectral::SCALAR));
+   }
+
+   return fields;
+}
+
+std::vector<details::BlockDescription>
+ModelBackend::explicitLinearBlockBuilder(const SpectralFieldId& rowId,
+   const SpectralFieldId& colId, const Resolution& res,
+   const std::vector<MHDFloat>& eigs, const BcMap& bcs,
+   const NonDimensional::NdMap& nds) const
+{
+   assert(eigs.size() == 2);
+
+   std::vector<details::BlockDescription> descr;
+
+   // Create description with common options
+   auto getDescription = [&]() -> details::BlockDescription&
+   {
+      descr.push_back({});
+      auto& d = descr.back();
+      auto opts = std::make_shared<implDetails::BlockOptionsImpl>();
+      opts->zi = nds.find(NonDimensional::Lower1d::id())->second->value();
+      opts->zo = nds.find(NonDimensional::Upper1d::id())->second->value();
+      opts->k1 = eigs.at(0);
+      opts->k2 = eigs.at(1);
+      opts->bcId = bcs.find(colId.first)->second;
+      opts->truncateQI = this->truncateQI();
+      opts->dropQIColumns = this->dropQIColumns();
+      opts->isSplitOperator = false;
+      opts->useSplitEquation = this->useSplitEquation();
+      opts->pBackend = this;
+      d.opts = opts;
+
+      return d;
+   };
+
+   if (rowId == std::make_pair(PhysicalNames::Velocity::id(),
+                   FieldComponents::Spectral::POL) &&
+       colId == std::make_pair(PhysicalNames::Temperature::id(),
+                   FieldComponents::Spectral::SCALAR))
+   {
+      // Real part of operator: buoyancy, same operator as the coupled
+      // implicit block of the Explicit backend
+      auto realOp = [](const int nNr, const int nNc, const int k1,
+                       std::shared_ptr<details::BlockOptions> opts,
+                       const NonDimensional::NdMap& nds)
+      {
+         SparseMatrix bMat(nNr, nNc);
+
+         auto& o =
+            *std::dynamic_pointer_cast<implDetails::BlockOptionsImpl>(opts);
+         auto Ra = nds.find(NonDimensional::Rayleigh::id())->second->value();
+         auto Pr = nds.find(NonDimensional::Prandtl::id())->second->value();
+
+         // laplh I4 = -k^2 I4
+         auto components = [&]() -> std::vector<SparseMatrix>
+         {
+            SparseSM::Chebyshev::LinearMap::I4 i4(nNr, nNc, o.zi, o.zo);
+            return {SparseMatrix(nNr, nNc), -i4.mat()};
+         };
+         bMat = affineBlock(o, "laplh_I4", nNr, nNc, components, -(Ra / Pr));
+
+         return bMat;
+      };
+
+      // Create block diagonal operator
+      auto& d = getDescription();
+      d.nRowShift = 0;
+      d.nColShift = 0;
+      d.realOp = realOp;
+      d.imagOp = nullptr;
+   }
+   else
+   {
+      throw std::logic_error("There are no explicit linear operators");
+   }
+
+   return descr;
+}
+
+} // namespace ExplicitBuoyancy
+} // namespace RBC
+} // namespace Plane
+} // namespace Boussinesq
+} // namespace Model
+} // namespace QuICC
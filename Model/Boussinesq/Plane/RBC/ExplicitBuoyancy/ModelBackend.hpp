@@ -0,0 +1,89 @@
+/**
+ * @file ModelBackend.hpp
+ * @brief Model backend with explicit buoyancy
+ */
+
+#ifndef QUICC_MODEL_BOUSSINESQ_PLANE_RBC_EXPLICITBUOYANCY_MODELBACKEND_HPP
+#define QUICC_MODEL_BOUSSINESQ_PLANE_RBC_EXPLICITBUOYANCY_MODELBACKEND_HPP
+
+// System includes
+//
+#include <vector>
+
+// Project includes
+//
+#include "Model/Boussinesq/Plane/RBC/Explicit/ModelBackend.hpp"
+
+namespace QuICC {
+
+namespace Model {
+
+namespace Boussinesq {
+
+namespace Plane {
+
+namespace RBC {
+
+namespace ExplicitBuoyancy {
+
+/**
+ * @brief Model backend with explicit buoyancy
+ *
+ * The buoyancy term of the poloidal equation is moved to the explicit linear
+ * right hand side. Toroidal, poloidal and temperature equations are then
+ * independent and each mode requires three banded solves instead of a single
+ * coupled one. All other operators are those of the Explicit backend.
+ */
+class ModelBackend : public Explicit::ModelBackend
+{
+public:
+   /**
+    * @brief Constructor
+    */
+   ModelBackend();
+
+   /**
+    * @brief Destructor
+    */
+   virtual ~ModelBackend() = default;
+
+protected:
+   /**
+    * @brief Set field coupling in implicit model matrix
+    *
+    * @param fId  Field ID
+    */
+   SpectralFieldIds implicitFields(const SpectralFieldId& fId) const final;
+
+   /**
+    * @brief Set field coupling for explicit linear terms
+    *
+    * @param fId  Field ID
+    */
+   SpectralFieldIds explicitLinearFields(
+      const SpectralFieldId& fId) const final;
+
+   /**
+    * @brief Build explicit linear matrix block description
+    *
+    * @param rowId   Field ID of block matrix row
+    * @param colId   Field ID of block matrix column
+    * @param res     Resolution object
+    * @param eigs    Slow indexes
+    * @param bcs     Boundary conditions for each field
+    * @param nds     Nondimension parameters
+    */
+   std::vector<details::BlockDescription> explicitLinearBlockBuilder(
+      const SpectralFieldId& rowId, const SpectralFieldId& colId,
+      const Resolution& res, const std::vector<MHDFloat>& eigs,
+      const BcMap& bcs, const NonDimensional::NdMap& nds) const final;
+};
+
+} // namespace ExplicitBuoyancy
+} // namespace RBC
+} // namespace Plane
+} // namespace Boussinesq
+} // namespace Model
+} // namespace QuICC
+
+#endif // QUICC_MODEL_BOUSSINESQ_PLANE_RBC_EXPLICITBUOYANCY_MODELBACKEND_HPP
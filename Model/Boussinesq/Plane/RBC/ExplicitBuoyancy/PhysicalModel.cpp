@@ -0,0 +1,52 @@
+/**
+ * @file PhysicalModel.cpp
+ * @brief Source of the Boussinesq Rayleigh-Benard convection in a plane layer
+ * (toroidal/poloidal formulation) model with explicit buoyancy
+ */
+
+// System includes
+//
+
+// Project includes
+//
+#include "Model/Boussinesq/Plane/RBC/ExplicitBuoyancy/PhysicalModel.hpp"
+#include "Model/Boussinesq/Plane/RBC/ExplicitBuoyancy/ModelBackend.hpp"
+#include "QuICC/Model/PyModelBackend.hpp"
+
+namespace QuICC {
+
+namespace Model {
+
+namespace Boussinesq {
+
+namespace Plane {
+
+namespace RBC {
+
+namespace ExplicitBuoyancy {
+
+std::string PhysicalModel::PYMODULE()
+{
+   return "boussinesq.plane.rbc.explicitbuoyancy.physical_model";
+}
+
+void PhysicalModel::init()
+{
+#ifdef QUICC_MODEL_BOUSSINESQPLANERBC_EXPLICITBUOYANCY_BACKEND_CPP
+   IPhysicalModel<Simulation, StateGenerator, VisualizationGenerator>::init();
+
+   this->mpBackend = std::make_shared<ModelBackend>();
+#else
+   IPhysicalPyModel<Simulation, StateGenerator, VisualizationGenerator>::init();
+
+   this->mpBackend =
+      std::make_shared<PyModelBackend>(this->PYMODULE(), this->PYCLASS());
+#endif
+}
+
+} // namespace ExplicitBuoyancy
+} // namespace RBC
+} // namespace Plane
+} // namespace Boussinesq
+} // namespace Model
+} // namespace QuICC
@@ -6,6 +6,7 @@
 // System includes
 //
 #include <stdexcept>
+#include <string>
 
 // Project includes
 //
@@ -22,6 +23,9 @@
 #include "QuICC/ModelOperator/ExplicitNextstep.hpp"
 #include "QuICC/ModelOperator/ExplicitNonlinear.hpp"
 #include "QuICC/ModelOperator/ImplicitLinear.hpp"
+#include "QuICC/ModelOperator/SplitBoundary.hpp"
+#include "QuICC/ModelOperator/SplitBoundaryValue.hpp"
+#include "QuICC/ModelOperator/SplitImplicitLinear.hpp"
 #include "QuICC/ModelOperator/Stencil.hpp"
 #include "QuICC/ModelOperator/Time.hpp"
 #include "QuICC/ModelOperatorBoundary/FieldToRhs.hpp"
@@ -32,6 +36,7 @@
 #include "QuICC/NonDimensional/Prandtl.hpp"
 #include "QuICC/NonDimensional/Rayleigh.hpp"
 #include "QuICC/NonDimensional/Upper1d.hpp"
+#include "QuICC/PhysicalNames/Coordinator.hpp"
 #include "QuICC/PhysicalNames/Temperature.hpp"
 #include "QuICC/PhysicalNames/Velocity.hpp"
 #include "QuICC/Resolutions/Tools/IndexCounter.hpp"
@@ -92,6 +97,105 @@ std::map<std::string, MHDFloat> IRBCBackend::automaticParameters(
    return params;
 }
 
+bool IRBCBackend::truncateQI() const
+{
+#ifdef QUICC_TRANSFORM_CHEBYSHEV_TRUNCATE_QI
+   return true;
+#else
+   return false;
+#endif // QUICC_TRANSFORM_CHEBYSHEV_TRUNCATE_QI
+}
+
+void IRBCBackend::setDropQIColumns(const bool flag)
+{
+   this->mDropQIColumns = flag;
+}
+
+bool IRBCBackend::dropQIColumns() const
+{
+   return this->mDropQIColumns;
+}
+
+void IRBCBackend::setMemoryReport(std::shared_ptr<MemoryReport> spReport)
+{
+   this->mspMemoryReport = spReport;
+}
+
+const AffineOperator& IRBCBackend::affineOperator(const AffineKey& key,
+   const ComponentsBuilder& components) const
+{
+   {
+      std::lock_guard<std::mutex> lock(this->mAffineMutex);
+      auto it = this->mAffineOperators.find(key);
+      if (it != this->mAffineOperators.end())
+      {
+         return *it->second;
+      }
+   }
+
+   // Build outside of the lock, concurrent builds are resolved on insertion
+   auto spOp = std::make_unique<AffineOperator>(components());
+
+   std::lock_guard<std::mutex> lock(this->mAffineMutex);
+   auto it = this->mAffineOperators.emplace(key, std::move(spOp)).first;
+   return *it->second;
+}
+
+void IRBCBackend::recordOperator(const DecoupledZSparse& mat,
+   const std::size_t opId, const SpectralFieldId& fId, const int matIdx) const
+{
+   if (!this->mspMemoryReport)
+   {
+      return;
+   }
+
+   std::string opName;
+   if (opId == ModelOperator::Time::id())
+   {
+      opName = "time";
+   }
+   else if (opId == ModelOperator::ImplicitLinear::id())
+   {
+      opName = "implicit_linear";
+   }
+   else if (opId == ModelOperator::SplitImplicitLinear::id())
+   {
+      opName = "split_implicit_linear";
+   }
+   else if (opId == ModelOperator::Boundary::id())
+   {
+      opName = "boundary";
+   }
+   else if (opId == ModelOperator::SplitBoundary::id())
+   {
+      opName = "split_boundary";
+   }
+   else if (opId == ModelOperator::SplitBoundaryValue::id())
+   {
+      opName = "split_boundary_value";
+   }
+   else if (opId == ModelOperator::ExplicitLinear::id())
+   {
+      opName = "explicit_linear";
+   }
+   else if (opId == ModelOperator::ExplicitNonlinear::id())
+   {
+      opName = "explicit_nonlinear";
+   }
+   else if (opId == ModelOperator::ExplicitNextstep::id())
+   {
+      opName = "explicit_nextstep";
+   }
+   else
+   {
+      opName = "other";
+   }
+
+   const auto field = PhysicalNames::Coordinator::tag(fId.first) + "_" +
+                      std::to_string(fId.second);
+   this->mspMemoryReport->addOperator(opName, field, matIdx, mat);
+}
+
 int IRBCBackend::nBc(const SpectralFieldId& fId) const
 {
    int nBc = 0;
@@ -129,14 +233,43 @@ void IRBCBackend::applyTau(SparseMatrix& mat, const SpectralFieldId& rowId,
 
    auto bcId = bcs.find(rowId.first)->second;
 
+   if (rowId == colId)
+   {
+      auto spOpts =
+         std::dynamic_pointer_cast<implDetails::BlockOptionsImpl>(opts);
+      if (!spOpts)
+      {
+         throw std::logic_error("Tau lines need the block options of the "
+                                "RBC backend");
+      }
+      const bool isMean = (spOpts->k1 == 0 && spOpts->k2 == 0);
+      const bool useSplit = this->useSplitEquation();
+
+      const std::vector<long> ids = {static_cast<long>(rowId.first),
+         static_cast<long>(rowId.second), static_cast<long>(bcId), isMean,
+         useSplit, isSplitOperator};
+      mat += this->mOperatorStore.get(
+         OperatorStore::key("tau", nN, zi, zo, ids),
+         [&]()
+         {
+            return tauOperator(rowId, nN, zi, zo, bcId, isMean, useSplit,
+               isSplitOperator);
+         });
+   }
+}
+
+SparseMatrix IRBCBackend::tauOperator(const SpectralFieldId& fId,
+   const int nN, const Internal::MHDFloat zi, const Internal::MHDFloat zo,
+   const std::size_t bcId, const bool isMean, const bool useSplitEquation,
+   const bool isSplitOperator)
+{
    namespace Boundary = SparseSM::Chebyshev::LinearMap::Boundary;
    typedef Boundary::ICondition::Position Position;
 
    Boundary::Operator bcOp(nN, nN, zi, zo);
 
-   if (rowId == std::make_pair(PhysicalNames::Velocity::id(),
-                   FieldComponents::Spectral::TOR) &&
-       rowId == colId)
+   if (fId == std::make_pair(PhysicalNames::Velocity::id(),
+                 FieldComponents::Spectral::TOR))
    {
       if (bcId == Bc::Name::NoSlip::id())
       {
@@ -154,11 +287,10 @@ void IRBCBackend::applyTau(SparseMatrix& mat, const SpectralFieldId& rowId,
                                 "component not implemented");
       }
    }
-   else if (rowId == std::make_pair(PhysicalNames::Velocity::id(),
-                        FieldComponents::Spectral::POL) &&
-            rowId == colId)
+   else if (fId == std::make_pair(PhysicalNames::Velocity::id(),
+                      FieldComponents::Spectral::POL))
    {
-      if (this->useSplitEquation())
+      if (useSplitEquation)
       {
          if (isSplitOperator)
          {
@@ -186,14 +318,11 @@ void IRBCBackend::applyTau(SparseMatrix& mat, const SpectralFieldId& rowId,
       }
       else
       {
-         auto& o =
-            *std::dynamic_pointer_cast<implDetails::BlockOptionsImpl>(opts);
-
          if (bcId == Bc::Name::NoSlip::id())
          {
             bcOp.addRow<Boundary::Value>(Position::TOP);
             bcOp.addRow<Boundary::Value>(Position::BOTTOM);
-            if (!(o.k1 == 0 && o.k2 == 0))
+            if (!isMean)
             {
                bcOp.addRow<Boundary::D1>(Position::TOP);
                bcOp.addRow<Boundary::D1>(Position::BOTTOM);
@@ -201,7 +330,7 @@ void IRBCBackend::applyTau(SparseMatrix& mat, const SpectralFieldId& rowId,
          }
          else if (bcId == Bc::Name::StressFree::id())
          {
-            if (o.k1 == 0 && o.k2 == 0)
+            if (isMean)
             {
                bcOp.addRow<Boundary::D1>(Position::TOP);
                bcOp.addRow<Boundary::D1>(Position::BOTTOM);
@@ -221,9 +350,8 @@ void IRBCBackend::applyTau(SparseMatrix& mat, const SpectralFieldId& rowId,
          }
       }
    }
-   else if (rowId == std::make_pair(PhysicalNames::Temperature::id(),
-                        FieldComponents::Spectral::SCALAR) &&
-            rowId == colId)
+   else if (fId == std::make_pair(PhysicalNames::Temperature::id(),
+                      FieldComponents::Spectral::SCALAR))
    {
       if (bcId == Bc::Name::FixedTemperature::id())
       {
@@ -243,7 +371,7 @@ void IRBCBackend::applyTau(SparseMatrix& mat, const SpectralFieldId& rowId,
       }
    }
 
-   mat += bcOp.mat();
+   return bcOp.mat();
 }
 
 void IRBCBackend::stencil(SparseMatrix& mat, const SpectralFieldId& fieldId,
@@ -257,6 +385,19 @@ void IRBCBackend::stencil(SparseMatrix& mat, const SpectralFieldId& fieldId,
 
    auto bcId = bcs.find(fieldId.first)->second;
 
+   const std::vector<long> ids = {static_cast<long>(fieldId.first),
+      static_cast<long>(fieldId.second), static_cast<long>(bcId), makeSquare};
+   mat = this->mOperatorStore.get(
+      OperatorStore::key("stencil", nN, zi, zo, ids),
+      [&]()
+      { return this->buildStencil(fieldId, nN, zi, zo, bcId, makeSquare); });
+}
+
+SparseMatrix IRBCBackend::buildStencil(const SpectralFieldId& fieldId,
+   const int nN, const Internal::MHDFloat zi, const Internal::MHDFloat zo,
+   const std::size_t bcId, const bool makeSquare) const
+{
+   SparseMatrix mat;
    namespace Stencil = SparseSM::Chebyshev::LinearMap::Stencil;
    int s = this->nBc(fieldId);
    if (fieldId == std::make_pair(PhysicalNames::Velocity::id(),
@@ -322,6 +463,8 @@ void IRBCBackend::stencil(SparseMatrix& mat, const SpectralFieldId& fieldId,
       SparseSM::Chebyshev::LinearMap::Id qId(nN - s, nN, zi, zo);
       mat = qId.mat() * mat;
    }
+
+   return mat;
 }
 
 void IRBCBackend::applyGalerkinStencil(SparseMatrix& mat,
@@ -339,8 +482,15 @@ void IRBCBackend::applyGalerkinStencil(SparseMatrix& mat,
    this->stencil(S, colId, k1c, res, false, bcs, nds);
 
    auto s = this->nBc(rowId);
-   SparseSM::Chebyshev::LinearMap::Id qId(nNr - s, nNr, zi, zo, 0, s);
-   mat = qId.mat() * (mat * S);
+   auto qId = this->mOperatorStore.get(
+      OperatorStore::key("Id_galerkin", nNr, zi, zo, {s}),
+      [&]()
+      {
+         return SparseMatrix(
+            SparseSM::Chebyshev::LinearMap::Id(nNr - s, nNr, zi, zo, 0, s)
+               .mat());
+      });
+   mat = qId * (mat * S);
 }
 
 
@@ -8,13 +8,19 @@
 
 // System includes
 //
+#include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <tuple>
 #include <vector>
 
 // Project includes
 //
+#include "Model/Boussinesq/Plane/RBC/AffineOperator.hpp"
+#include "Model/Boussinesq/Plane/RBC/MemoryReport.hpp"
+#include "Model/Boussinesq/Plane/RBC/OperatorStore.hpp"
 #include "QuICC/Model/IPlaneModelBackend.hpp"
 #include "Types/Internal/BasicTypes.hpp"
 
@@ -34,6 +40,15 @@ namespace RBC {
 class IRBCBackend : public IPlaneModelBackend
 {
 public:
+   /// Builder of the k-independent components of an operator
+   typedef std::function<std::vector<SparseMatrix>()> ComponentsBuilder;
+
+   /// Key of an operator polynomial in k^2: name, rows, columns, lower and
+   /// upper boundary, boundary condition and column drop
+   typedef std::tuple<std::string, int, int, Internal::MHDFloat,
+      Internal::MHDFloat, std::size_t, bool>
+      AffineKey;
+
    /**
     * @brief Constructor
     */
@@ -67,6 +82,62 @@ public:
    virtual std::map<std::string, MHDFloat> automaticParameters(
       const std::map<std::string, MHDFloat>& cfg) const override;
 
+   /**
+    * @brief Use truncated quasi-inverse operators?
+    *
+    * Fixed by QUICC_TRANSFORM_CHEBYSHEV_TRUNCATE_QI, the transforms use the
+    * same setting
+    */
+   bool truncateQI() const;
+
+   /**
+    * @brief Set dropping of the last two columns of the no-slip poloidal
+    * time operator
+    *
+    * @param flag Drop the columns?
+    */
+   void setDropQIColumns(const bool flag);
+
+   /**
+    * @brief Drop the last two columns of the no-slip poloidal time operator?
+    */
+   bool dropQIColumns() const;
+
+   /**
+    * @brief Set memory footprint report filled by the operator builders
+    *
+    * @param spReport   Shared memory report
+    */
+   void setMemoryReport(std::shared_ptr<MemoryReport> spReport);
+
+   /**
+    * @brief Operator polynomial in k^2, decomposed on its first request
+    *
+    * Thread safe, the operator stays valid for the lifetime of the backend
+    *
+    * @param key        Key of the operator
+    * @param components Builder of the components of the powers of k^2
+    */
+   const AffineOperator& affineOperator(const AffineKey& key,
+      const ComponentsBuilder& components) const;
+
+   /**
+    * @brief Tau operator holding the boundary condition rows
+    *
+    * @param fId     Field ID
+    * @param nN      Size of Chebyshev expansion
+    * @param zi      Lower boundary
+    * @param zo      Upper boundary
+    * @param bcId    Boundary condition ID
+    * @param isMean  Operator is for the k1 = k2 = 0 mean mode?
+    * @param useSplitEquation Poloidal equation is split into two systems?
+    * @param isSplitOperator  Is second operator of split 4th order system?
+    */
+   static SparseMatrix tauOperator(const SpectralFieldId& fId, const int nN,
+      const Internal::MHDFloat zi, const Internal::MHDFloat zo,
+      const std::size_t bcId, const bool isMean, const bool useSplitEquation,
+      const bool isSplitOperator);
+
 protected:
    /**
     * @brief Number of boundary conditions
@@ -78,6 +149,9 @@ protected:
    /**
     * @brief Apply tau line for boundary condition
     *
+    * The tau lines only depend on the resolution, the boundary condition
+    * and the mean mode flag, they are taken from the operator store
+    *
     * @param mat     Input/Output matrix to apply tau line to
     * @param rowId   ID of field of equation
     * @param colId   ID of field
@@ -97,6 +171,9 @@ protected:
    /**
     * @brief Boundary condition stencil
     *
+    * The stencil does not depend on the wave number, it is taken from the
+    * operator store
+    *
     * @param mat        Input/Output matrix to store galerkin stencil
     * @param fID        Field ID
     * @param k1         First wave number
@@ -127,7 +204,57 @@ protected:
       std::shared_ptr<details::BlockOptions> opts, const Resolution& res,
       const BcMap& bcs, const NonDimensional::NdMap& nds) const override;
 
+   /**
+    * @brief Record operator in memory footprint report
+    *
+    * @param mat     Operator
+    * @param opId    Type of operator
+    * @param fId     Field ID of equation
+    * @param matIdx  Matrix index
+    */
+   void recordOperator(const DecoupledZSparse& mat, const std::size_t opId,
+      const SpectralFieldId& fId, const int matIdx) const;
+
 private:
+   /**
+    * @brief Boundary condition stencil, built on the first request
+    *
+    * @param fId        Field ID
+    * @param nN         Size of Chebyshev expansion
+    * @param zi         Lower boundary
+    * @param zo         Upper boundary
+    * @param bcId       Boundary condition ID
+    * @param makeSquare Truncate operator to make square
+    */
+   SparseMatrix buildStencil(const SpectralFieldId& fId, const int nN,
+      const Internal::MHDFloat zi, const Internal::MHDFloat zo,
+      const std::size_t bcId, const bool makeSquare) const;
+
+   /**
+    * @brief Memory footprint report
+    */
+   std::shared_ptr<MemoryReport> mspMemoryReport;
+
+   /**
+    * @brief Store of the k-independent operators
+    */
+   mutable OperatorStore mOperatorStore;
+
+   /**
+    * @brief Operators polynomial in k^2
+    */
+   mutable std::map<AffineKey, std::unique_ptr<AffineOperator>>
+      mAffineOperators;
+
+   /**
+    * @brief Lock of the operators polynomial in k^2
+    */
+   mutable std::mutex mAffineMutex;
+
+   /**
+    * @brief Drop the last two columns of the no-slip poloidal time operator?
+    */
+   bool mDropQIColumns = false;
 };
 
 namespace implDetails {
@@ -157,12 +284,16 @@ struct BlockOptionsImpl : public details::BlockOptions
    MHDFloat k2;
    /// Use truncated quasi-inverse?
    bool truncateQI;
+   /// Drop last two columns of no-slip poloidal time operator?
+   bool dropQIColumns;
    /// Boundary condition
    std::size_t bcId;
    /// Split operator for influence matrix?
    bool isSplitOperator;
    /// Use split equation for influence matrix?
    bool useSplitEquation;
+   /// Backend holding the operators polynomial in k^2
+   const IRBCBackend* pBackend = nullptr;
 };
 } // namespace implDetails
 
@@ -6,13 +6,28 @@
 
 // System includes
 //
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <vector>
 
 // Project includes
 //
+#include "Model/Boussinesq/Plane/RBC/EigenmodeKernel.hpp"
+#include "Model/Boussinesq/Plane/RBC/IRBCBackend.hpp"
 #include "Model/Boussinesq/Plane/RBC/IRBCModel.hpp"
+#include "Model/Boussinesq/Plane/RBC/LinearStability.hpp"
+#include "Model/Boussinesq/Plane/RBC/MemoryReport.hpp"
 #include "Model/Boussinesq/Plane/RBC/Momentum.hpp"
+#include "Model/Boussinesq/Plane/RBC/RandomSpectrumKernel.hpp"
+#include "Model/Boussinesq/Plane/RBC/ResampledStateKernel.hpp"
 #include "Model/Boussinesq/Plane/RBC/Transport.hpp"
 #include "Model/Boussinesq/Plane/RBC/gitHash.hpp"
+#include "QuICC/Bc/Name/FixedFlux.hpp"
+#include "QuICC/Bc/Name/FixedTemperature.hpp"
+#include "QuICC/Bc/Name/NoSlip.hpp"
+#include "QuICC/Bc/Name/StressFree.hpp"
 #include "QuICC/Enums/FieldIds.hpp"
 #include "QuICC/Io/Variable/Cartesian1DScalarEnergyWriter.hpp"
 #include "QuICC/Io/Variable/Cartesian1DTorPolEnergyWriter.hpp"
@@ -45,6 +60,32 @@ namespace Plane {
 
 namespace RBC {
 
+std::size_t IRBCModel::velocityBcId(const int opt)
+{
+   switch (opt)
+   {
+   case 0:
+      return Bc::Name::NoSlip::id();
+   case 1:
+      return Bc::Name::StressFree::id();
+   default:
+      throw std::logic_error("Unknown velocity boundary condition");
+   }
+}
+
+std::size_t IRBCModel::temperatureBcId(const int opt)
+{
+   switch (opt)
+   {
+   case 0:
+      return Bc::Name::FixedTemperature::id();
+   case 1:
+      return Bc::Name::FixedFlux::id();
+   default:
+      throw std::logic_error("Unknown temperature boundary condition");
+   }
+}
+
 VectorFormulation::Id IRBCModel::SchemeFormulation()
 {
    return VectorFormulation::TORPOL;
@@ -57,6 +98,26 @@ std::string IRBCModel::version() const
 
 void IRBCModel::addEquations(SharedSimulation spSim)
 {
+   // Drop the last two columns of the no-slip poloidal time operator, only
+   // the C++ backends support it
+   auto spRBC = std::dynamic_pointer_cast<IRBCBackend>(this->spBackend());
+   if (this->tagOption(spSim, "operators", "drop_qi_columns") == 1)
+   {
+      if (!spRBC)
+      {
+         throw std::logic_error(
+            "operators/drop_qi_columns requires a C++ backend");
+      }
+      spRBC->setDropQIColumns(true);
+   }
+
+   // Operator memory footprint, written when the backend is released
+   if (spRBC && this->tagOption(spSim, "memory_report", "enable") == 1)
+   {
+      spRBC->setMemoryReport(
+         std::make_shared<MemoryReport>("memory_report.dat"));
+   }
+
    // Add transport equation
    spSim->addEquation<Equations::Boussinesq::Plane::RBC::Transport>(
       this->spBackend());
@@ -72,83 +133,194 @@ void IRBCModel::addStates(SharedStateGenerator spGen)
    Equations::SharedCartesianExactScalarState spScalar;
    Equations::SharedCartesianExactVectorState spVector;
 
+   const bool isComplex =
+      spGen->ss().has(SpatialScheme::Feature::ComplexSpectrum);
+
+   // Resample field stored in state file at different resolution, the
+   // stored modes are read and resampled collectively on creation
+   std::vector<SharedResampledStateKernel> resampled;
+   auto makeResampled = [&](const SpectralFieldId& fId,
+                           const std::string& dataset, const std::size_t bcId)
+   {
+      auto params = this->spBackend()->automaticParameters({});
+      auto spKernel = std::make_shared<ResampledStateKernel>(isComplex);
+      spKernel->init("state_restart.hdf5", dataset, fId, bcId,
+         params.at(NonDimensional::Lower1d().tag()),
+         params.at(NonDimensional::Upper1d().tag()),
+         this->spBackend()->useSplitEquation(), spGen->res());
+      resampled.push_back(spKernel);
+      return spKernel;
+   };
+
+   // Superposition of linear eigenmodes, shared by temperature and velocity
+   SharedEigenmodeKernel spEigenmode;
+   auto makeEigenmode = [&](const FieldComponents::Spectral::Id comp)
+   {
+      if (!spEigenmode)
+      {
+         auto params = this->spBackend()->automaticParameters({});
+         const auto& phys = spGen->config().physical();
+         const auto velBcId = velocityBcId(
+            this->boundaryOption(spGen, PhysicalNames::Velocity().tag()));
+         const auto tempBcId = temperatureBcId(
+            this->boundaryOption(spGen, PhysicalNames::Temperature().tag()));
+         auto spStability = std::make_shared<LinearStability>(
+            spGen->res().sim().dim(Dimensions::Simulation::SIM1D,
+               Dimensions::Space::SPECTRAL),
+            params.at(NonDimensional::Lower1d().tag()),
+            params.at(NonDimensional::Upper1d().tag()),
+            phys.at(NonDimensional::Rayleigh().tag()),
+            phys.at(NonDimensional::Prandtl().tag()), velBcId, tempBcId);
+         spStability->setDropQIColumns(
+            this->tagOption(spGen, "operators", "drop_qi_columns") == 1);
+
+         spEigenmode = std::make_shared<EigenmodeKernel>(isComplex);
+         spEigenmode->init(spStability,
+            this->tagOption(spGen, "eigenmode", "modes"),
+            this->tagOption(spGen, "eigenmode", "max_index"),
+            this->tagOption(spGen, "eigenmode", "max_shells"),
+            std::pow(10.0, this->tagOption(spGen, "eigenmode", "amplitude")),
+            this->tagOption(spGen, "eigenmode", "seed"), spGen->res());
+      }
+
+      // Copies share the selected modes
+      auto spKernel = std::make_shared<EigenmodeKernel>(*spEigenmode);
+      spKernel->setComponent(comp);
+      return spKernel;
+   };
+
    // Add temperature initial state generator
    spScalar = spGen->addEquation<Equations::CartesianExactScalarState>(
       this->spBackend());
    spScalar->setIdentity(PhysicalNames::Temperature::id());
-   switch (0)
+
+   MHDFloat amp =
+      std::pow(10.0, this->tagOption(spGen, "temperature_init", "amplitude"));
+   MHDFloat ratio =
+      std::pow(10.0, this->tagOption(spGen, "temperature_init", "ratio"));
+   std::uint64_t seed = this->tagOption(spGen, "temperature_init", "seed");
+   switch (this->tagOption(spGen, "temperature_init", "type"))
    {
    case 0: {
-      spScalar->setPhysicalNoise(1e-15);
+      spScalar->setPhysicalNoise(amp);
    }
    break;
 
    case 1: {
-      spScalar->setPhysicalConstant(1.0);
+      spScalar->setPhysicalConstant(amp);
    }
    break;
 
    case 2: {
-      // spScalar->setStateType(Equations::CartesianExactStateIds::PLANFORMSQUARES);
-      // spScalar->setModeOptions(1e0, 10.0, 1e0, 10.0);
+      auto spKernel =
+         std::make_shared<Spectral::Kernel::MakeRandom>(isComplex);
+      std::vector<MHDFloat> ratios = {ratio, ratio, ratio};
+      spKernel->setRatio(ratios);
+      spKernel->init(-amp, amp);
+      spScalar->setSrcKernel(FieldComponents::Spectral::SCALAR, spKernel);
    }
    break;
 
    case 3: {
-      auto spKernel = std::make_shared<Spectral::Kernel::MakeRandom>(
-         spGen->ss().has(SpatialScheme::Feature::ComplexSpectrum));
-      std::vector<MHDFloat> ratios = {1e2, 1e2, 1e2};
+      auto spKernel =
+         std::make_shared<RandomSpectrumKernel>(isComplex);
+      std::vector<MHDFloat> ratios = {ratio, ratio, ratio};
       spKernel->setRatio(ratios);
-      spKernel->init(-1e-15, 1e-15);
-      spVector->setSrcKernel(FieldComponents::Spectral::SCALAR, spKernel);
+      spKernel->init(-amp, amp, seed, 0);
+      spScalar->setSrcKernel(FieldComponents::Spectral::SCALAR, spKernel);
    }
    break;
+
+   case 4: {
+      const auto tag = PhysicalNames::Temperature().tag();
+      const auto bcId =
+         temperatureBcId(this->boundaryOption(spGen, tag));
+      auto spKernel = makeResampled(
+         std::make_pair(PhysicalNames::Temperature::id(),
+            FieldComponents::Spectral::SCALAR),
+         "/" + tag + "/" + tag, bcId);
+      spScalar->setSrcKernel(FieldComponents::Spectral::SCALAR, spKernel);
+   }
+   break;
+
+   case 5: {
+      spScalar->setSrcKernel(FieldComponents::Spectral::SCALAR,
+         makeEigenmode(FieldComponents::Spectral::SCALAR));
+   }
+   break;
+
+   default:
+      throw std::logic_error("Unknown temperature initial state");
    }
 
    // Add velocity initial state generator
    spVector = spGen->addEquation<Equations::CartesianExactVectorState>(
       this->spBackend());
    spVector->setIdentity(PhysicalNames::Velocity::id());
-   switch (2)
+
+   amp = std::pow(10.0, this->tagOption(spGen, "velocity_init", "amplitude"));
+   ratio = std::pow(10.0, this->tagOption(spGen, "velocity_init", "ratio"));
+   seed = this->tagOption(spGen, "velocity_init", "seed");
+   switch (this->tagOption(spGen, "velocity_init", "type"))
    {
    case 0: {
-      spScalar->setPhysicalNoise(1e-15);
+      auto spKernel =
+         std::make_shared<Spectral::Kernel::MakeRandom>(isComplex);
+      std::vector<MHDFloat> ratios = {ratio, ratio, ratio};
+      spKernel->setRatio(ratios);
+      spKernel->init(-amp, amp);
+      spVector->setSrcKernel(FieldComponents::Spectral::TOR, spKernel);
+      spVector->setSrcKernel(FieldComponents::Spectral::POL, spKernel);
    }
    break;
 
    case 1: {
-      spScalar->setPhysicalConstant(1.0);
+      std::vector<MHDFloat> ratios = {ratio, ratio, ratio};
+
+      // Use independent streams for both components
+      auto spTor =
+         std::make_shared<RandomSpectrumKernel>(isComplex);
+      spTor->setRatio(ratios);
+      spTor->init(-amp, amp, seed, 1);
+      spVector->setSrcKernel(FieldComponents::Spectral::TOR, spTor);
+
+      auto spPol =
+         std::make_shared<RandomSpectrumKernel>(isComplex);
+      spPol->setRatio(ratios);
+      spPol->init(-amp, amp, seed, 2);
+      spVector->setSrcKernel(FieldComponents::Spectral::POL, spPol);
    }
    break;
 
    case 2: {
-      auto spKernel = std::make_shared<Spectral::Kernel::MakeRandom>(
-         spGen->ss().has(SpatialScheme::Feature::ComplexSpectrum));
-      std::vector<MHDFloat> ratios = {1e2, 1e2, 1e2};
-      spKernel->setRatio(ratios);
-      spKernel->init(-1e-15, 1e-15);
-      spVector->setSrcKernel(FieldComponents::Spectral::TOR, spKernel);
-      spVector->setSrcKernel(FieldComponents::Spectral::POL, spKernel);
+      const auto tag = PhysicalNames::Velocity().tag();
+      const auto bcId = velocityBcId(this->boundaryOption(spGen, tag));
+      auto spTor = makeResampled(std::make_pair(PhysicalNames::Velocity::id(),
+                                    FieldComponents::Spectral::TOR),
+         "/" + tag + "/" + tag + "_tor", bcId);
+      spVector->setSrcKernel(FieldComponents::Spectral::TOR, spTor);
+      auto spPol = makeResampled(std::make_pair(PhysicalNames::Velocity::id(),
+                                    FieldComponents::Spectral::POL),
+         "/" + tag + "/" + tag + "_pol", bcId);
+      spVector->setSrcKernel(FieldComponents::Spectral::POL, spPol);
    }
    break;
 
    case 3: {
-      auto spKernel = std::make_shared<Spectral::Kernel::MakeRandom>(
-         spGen->ss().has(SpatialScheme::Feature::ComplexSpectrum));
-      std::vector<MHDFloat> ratios = {1e4, 1e4, 1e4};
-      spKernel->setRatio(ratios);
-      spKernel->init(-1e-4, 1e-4);
-      spVector->setSrcKernel(FieldComponents::Spectral::TOR, spKernel);
-      spVector->setSrcKernel(FieldComponents::Spectral::POL, spKernel);
+      spVector->setSrcKernel(FieldComponents::Spectral::TOR,
+         makeEigenmode(FieldComponents::Spectral::TOR));
+      spVector->setSrcKernel(FieldComponents::Spectral::POL,
+         makeEigenmode(FieldComponents::Spectral::POL));
    }
    break;
 
-   case 4: {
-      // spVector->setStateType(Equations::CartesianExactStateIds::TORPOLTFF);
-   }
-   break;
+   default:
+      throw std::logic_error("Unknown velocity initial state");
    }
 
+   // Read bandwidth of the resampled state
+   ResampledStateKernel::writeReport("restart_read.dat", resampled);
+
    // Add output file
    auto spOut =
       std::make_shared<Io::Variable::StateFileWriter>(spGen->ss().tag(),
@@ -190,7 +362,7 @@ std::map<std::string, std::map<std::string, int>> IRBCModel::configTags() const
    onOff.emplace("enable", 1);
 
    std::map<std::string, int> offOn;
-   onOff.emplace("enable", 0);
+   offOn.emplace("enable", 0);
 
    std::map<std::string, std::map<std::string, int>> tags;
    // kinetic
@@ -199,6 +371,42 @@ std::map<std::string, std::map<std::string, int>> IRBCModel::configTags() const
    tags.emplace("temperature_energy", onOff);
    tags.emplace("temperature_nusselt", offOn);
 
+   // Initial states: amplitude and spectral ratio are given as powers of 10
+   //    temperature: 0 = physical noise, 1 = constant, 2 = random spectrum,
+   //                 3 = counter-based random spectrum, 4 = resampled state,
+   //                 5 = linear eigenmodes
+   //    velocity: 0 = random spectrum, 1 = counter-based random spectrum,
+   //              2 = resampled state, 3 = linear eigenmodes
+   // Resampled states are read from state_restart.hdf5 with the boundary
+   // conditions of the boundary section, each rank reads only its own modes
+   // and the read bandwidth is written to restart_read.dat
+   std::map<std::string, int> tempInit = {
+      {"type", 0}, {"amplitude", -15}, {"ratio", 2}, {"seed", 1}};
+   tags.emplace("temperature_init", tempInit);
+   std::map<std::string, int> velInit = {
+      {"type", 0}, {"amplitude", -15}, {"ratio", 2}, {"seed", 1}};
+   tags.emplace("velocity_init", velInit);
+
+   // Superposition of the fastest growing linear eigenmodes with horizontal
+   // wave index up to max_index, amplitude of the maximum temperature
+   // coefficient is given as power of 10. The eigenmodes use the boundary
+   // conditions of the boundary section. The modes are selected on the first
+   // rank, which solves one eigenvalue problem per wave number shell, at most
+   // max_shells of them
+   std::map<std::string, int> eigenmode = {{"modes", 1}, {"max_index", 8},
+      {"max_shells", 128}, {"amplitude", -3}, {"seed", 1}};
+   tags.emplace("eigenmode", eigenmode);
+
+   // Operators: drop_qi_columns = 1 drops the last two columns of the
+   // no-slip poloidal time operator (McFadden, Murray, Boisvert, JCP 91,
+   // 1990), also for the eigenmode initial state
+   std::map<std::string, int> operators = {{"drop_qi_columns", 0}};
+   tags.emplace("operators", operators);
+
+   // Storage of the operators built by the model backend, per rank and
+   // globally, written to memory_report.dat at the end of the run
+   tags.emplace("memory_report", offOn);
+
    return tags;
 }
 
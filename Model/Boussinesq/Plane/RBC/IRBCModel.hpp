@@ -9,6 +9,9 @@
 
 // System includes
 //
+#include <cstddef>
+#include <map>
+#include <stdexcept>
 #include <string>
 
 // Project includes
@@ -89,9 +92,79 @@ public:
    configTags() const override;
 
 protected:
+   /**
+    * @brief Get integer option of a model configuration tag
+    *
+    * Falls back to the default value from configTags() if the option is not
+    * present in the configuration file.
+    *
+    * @param spObj   Shared simulation or generator object
+    * @param tag     Configuration tag
+    * @param opt     Option name
+    */
+   template <typename TSharedObject>
+   int tagOption(TSharedObject spObj, const std::string& tag,
+      const std::string& opt) const;
+
+   /**
+    * @brief Get boundary condition of a field from the boundary section
+    *
+    * @param spObj   Shared simulation or generator object
+    * @param field   Field tag
+    */
+   template <typename TSharedObject>
+   int boundaryOption(TSharedObject spObj, const std::string& field) const;
+
+   /**
+    * @brief Boundary condition ID of the velocity
+    *
+    * @param opt  Boundary section option: 0 = no-slip, 1 = stress-free
+    */
+   static std::size_t velocityBcId(const int opt);
+
+   /**
+    * @brief Boundary condition ID of the temperature
+    *
+    * @param opt  Boundary section option: 0 = fixed temperature,
+    *             1 = fixed flux
+    */
+   static std::size_t temperatureBcId(const int opt);
+
 private:
 };
 
+template <typename TSharedObject>
+int IRBCModel::tagOption(TSharedObject spObj, const std::string& tag,
+   const std::string& opt) const
+{
+   const auto& cfg = spObj->config().model();
+   auto tagIt = cfg.find(tag);
+   if (tagIt != cfg.end())
+   {
+      auto optIt = tagIt->second.find(opt);
+      if (optIt != tagIt->second.end())
+      {
+         return optIt->second;
+      }
+   }
+
+   return this->configTags().at(tag).at(opt);
+}
+
+template <typename TSharedObject>
+int IRBCModel::boundaryOption(TSharedObject spObj,
+   const std::string& field) const
+{
+   const auto& bcs = spObj->config().boundary();
+   auto bcIt = bcs.find(field);
+   if (bcIt == bcs.end())
+   {
+      throw std::logic_error("No boundary condition for " + field);
+   }
+
+   return bcIt->second;
+}
+
 } // namespace RBC
 } // namespace Plane
 } // namespace Boussinesq
@@ -0,0 +1,189 @@
+/**
+ * @file LinearStability.cpp
+ * @brief Source of the linear stability of the conduction state
+ */
+
+// System includes
+//
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+// Project includes
+//
+#include "Model/Boussinesq/Plane/RBC/IRBCBackend.hpp"
+#include "Model/Boussinesq/Plane/RBC/LinearStability.hpp"
+#include "QuICC/Bc/Name/NoSlip.hpp"
+#include "QuICC/Enums/FieldIds.hpp"
+#include "QuICC/PhysicalNames/Temperature.hpp"
+#include "QuICC/PhysicalNames/Velocity.hpp"
+#include "QuICC/SparseSM/Chebyshev/LinearMap/I2.hpp"
+#include "QuICC/SparseSM/Chebyshev/LinearMap/I2Lapl.hpp"
+#include "QuICC/SparseSM/Chebyshev/LinearMap/I4.hpp"
+#include "QuICC/SparseSM/Chebyshev/LinearMap/I4Lapl.hpp"
+#include "QuICC/SparseSM/Chebyshev/LinearMap/I4Lapl2.hpp"
+#include "QuICC/SparseSM/Chebyshev/LinearMap/Id.hpp"
+
+namespace QuICC {
+
+namespace Model {
+
+namespace Boussinesq {
+
+namespace Plane {
+
+namespace RBC {
+
+LinearStability::LinearStability(const int nN, const Internal::MHDFloat zi,
+   const Internal::MHDFloat zo, const MHDFloat Ra, const MHDFloat Pr,
+   const std::size_t velBcId, const std::size_t tempBcId) :
+    mN(nN),
+    mZi(zi),
+    mZo(zo),
+    mRa(Ra),
+    mPr(Pr),
+    mVelBcId(velBcId),
+    mTempBcId(tempBcId)
+{}
+
+void LinearStability::setDropQIColumns(const bool flag)
+{
+   this->mDropQIColumns = flag;
+}
+
+void LinearStability::operators(SparseMatrix& B, SparseMatrix& diffusion,
+   SparseMatrix& buoyancy, SparseMatrix& advection, const MHDFloat k1,
+   const MHDFloat k2) const
+{
+   namespace LinearMap = SparseSM::Chebyshev::LinearMap;
+
+   const int nN = this->mN;
+   const auto zi = this->mZi;
+   const auto zo = this->mZo;
+   const auto laplh = -(k1 * k1 + k2 * k2);
+
+   auto velPol = std::make_pair(PhysicalNames::Velocity::id(),
+      FieldComponents::Spectral::POL);
+   auto temp = std::make_pair(PhysicalNames::Temperature::id(),
+      FieldComponents::Spectral::SCALAR);
+
+   Matrix time = Matrix::Zero(2 * nN, 2 * nN);
+   Matrix diff = Matrix::Zero(2 * nN, 2 * nN);
+   Matrix buoy = Matrix::Zero(2 * nN, 2 * nN);
+   Matrix adv = Matrix::Zero(2 * nN, 2 * nN);
+
+   // Poloidal row
+   SparseMatrix pp = laplh * LinearMap::I4Lapl2(nN, nN, zi, zo, k1, k2).mat();
+   pp += IRBCBackend::tauOperator(velPol, nN, zi, zo, this->mVelBcId, false,
+      false, false);
+   diff.topLeftCorner(nN, nN) = Matrix(pp);
+   buoy.topRightCorner(nN, nN) =
+      Matrix(-(this->mRa / this->mPr) * laplh *
+             LinearMap::I4(nN, nN, zi, zo).mat());
+   SparseMatrix bp = laplh * LinearMap::I4Lapl(nN, nN, zi, zo, k1, k2).mat();
+   if (this->mDropQIColumns && this->mVelBcId == Bc::Name::NoSlip::id())
+   {
+      LinearMap::Id qid(nN, nN, zi, zo, -2);
+      bp = bp * qid.mat();
+   }
+   time.topLeftCorner(nN, nN) = Matrix(bp);
+
+   // Temperature row
+   SparseMatrix tt =
+      (1.0 / this->mPr) * LinearMap::I2Lapl(nN, nN, zi, zo, k1, k2).mat();
+   tt += IRBCBackend::tauOperator(temp, nN, zi, zo, this->mTempBcId, false,
+      false, false);
+   diff.bottomRightCorner(nN, nN) = Matrix(tt);
+   adv.bottomLeftCorner(nN, nN) =
+      Matrix(-laplh * LinearMap::I2(nN, nN, zi, zo).mat());
+   time.bottomRightCorner(nN, nN) =
+      Matrix(LinearMap::I2(nN, nN, zi, zo).mat());
+
+   B = time.sparseView();
+   diffusion = diff.sparseView();
+   buoyancy = buoy.sparseView();
+   advection = adv.sparseView();
+}
+
+void LinearStability::buildOperators(Matrix& L, Matrix& B, const MHDFloat k1,
+   const MHDFloat k2) const
+{
+   SparseMatrix time, diffusion, buoyancy, advection;
+   this->operators(time, diffusion, buoyancy, advection, k1, k2);
+
+   L = Matrix(diffusion + buoyancy + advection);
+   B = Matrix(time);
+}
+
+MHDComplex LinearStability::fastest(ArrayZ& pol, ArrayZ& temp,
+   const MHDFloat k1, const MHDFloat k2) const
+{
+   if (k1 == 0 && k2 == 0)
+   {
+      throw std::logic_error("Mean mode has no unstable eigenmode");
+   }
+
+   Matrix L, B;
+   this->buildOperators(L, B, k1, k2);
+
+   // Shift-invert: eigenvalues mu of (L - s B)^{-1} B are 1/(sigma - s), the
+   // infinite eigenvalues of the tau formulation map to mu = 0
+   const MHDFloat shift = -1.0;
+   Matrix A = (L - shift * B).partialPivLu().solve(B);
+   Eigen::EigenSolver<Matrix> solver(A, true);
+
+   const auto& mu = solver.eigenvalues();
+   const auto& V = solver.eigenvectors();
+   const MHDFloat tol = 1e3 * std::numeric_limits<MHDFloat>::epsilon() *
+                        mu.cwiseAbs().maxCoeff();
+
+   // Spurious tau eigenmodes are not resolved: reject modes with significant
+   // energy in the last 10% of the Chebyshev expansion
+   const int nTail = std::max(4, this->mN / 10);
+   auto isResolved = [&](const int i)
+   {
+      MHDFloat tail = V.col(i).segment(this->mN - nTail, nTail).squaredNorm() +
+                      V.col(i).tail(nTail).squaredNorm();
+      return tail < 1e-6 * V.col(i).squaredNorm();
+   };
+
+   int best = -1;
+   MHDComplex sigma(-std::numeric_limits<MHDFloat>::max(), 0);
+   for (int i = 0; i < mu.size(); ++i)
+   {
+      if (std::abs(mu(i)) > tol && isResolved(i))
+      {
+         MHDComplex s = shift + 1.0 / mu(i);
+         if (s.real() > sigma.real())
+         {
+            sigma = s;
+            best = i;
+         }
+      }
+   }
+
+   if (best < 0)
+   {
+      throw std::logic_error("Linear stability eigenvalue solver failed");
+   }
+
+   MatrixZ x = V.col(best);
+   pol = x.topRows(this->mN);
+   temp = x.bottomRows(this->mN);
+
+   // Normalize to unit maximum temperature coefficient
+   Eigen::Index iMax;
+   temp.cwiseAbs().maxCoeff(&iMax);
+   const MHDComplex scale = temp(iMax);
+   pol /= scale;
+   temp /= scale;
+
+   return sigma;
+}
+
+} // namespace RBC
+} // namespace Plane
+} // namespace Boussinesq
+} // namespace Model
+} // namespace QuICC
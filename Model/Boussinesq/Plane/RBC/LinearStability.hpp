@@ -0,0 +1,166 @@
+/**
+ * @file LinearStability.hpp
+ * @brief Linear stability of the conduction state of the RBC model
+ */
+
+#ifndef QUICC_MODEL_BOUSSINESQ_PLANE_RBC_LINEARSTABILITY_HPP
+#define QUICC_MODEL_BOUSSINESQ_PLANE_RBC_LINEARSTABILITY_HPP
+
+// System includes
+//
+
+// Project includes
+//
+#include "Types/Internal/BasicTypes.hpp"
+#include "Types/Typedefs.hpp"
+
+namespace QuICC {
+
+namespace Model {
+
+namespace Boussinesq {
+
+namespace Plane {
+
+namespace RBC {
+
+/**
+ * @brief Linear stability of the conduction state of the RBC model
+ *
+ * The toroidal component decouples and always decays. The coupled
+ * poloidal/temperature system is built from the same Chebyshev quasi-inverse
+ * operators and tau lines as the Explicit model backend, extended by the
+ * advection of the linear conduction profile. The generalized eigenvalue
+ * problem
+ *
+ *    \f$ L x = \sigma B x \f$
+ *
+ * is solved densely through a shift-invert transformation, which maps the
+ * infinite eigenvalues introduced by the tau lines to zero.
+ */
+class LinearStability
+{
+public:
+   /**
+    * @brief Constructor
+    *
+    * @param nN         Size of Chebyshev expansion
+    * @param zi         Lower boundary
+    * @param zo         Upper boundary
+    * @param Ra         Rayleigh number
+    * @param Pr         Prandtl number
+    * @param velBcId    Boundary condition ID of velocity
+    * @param tempBcId   Boundary condition ID of temperature
+    */
+   LinearStability(const int nN, const Internal::MHDFloat zi,
+      const Internal::MHDFloat zo, const MHDFloat Ra, const MHDFloat Pr,
+      const std::size_t velBcId, const std::size_t tempBcId);
+
+   /**
+    * @brief Destructor
+    */
+   ~LinearStability() = default;
+
+   /**
+    * @brief Set dropping of the last two columns of the no-slip poloidal
+    * time operator, as in the model backend
+    *
+    * @param flag Drop the columns?
+    */
+   void setDropQIColumns(const bool flag);
+
+   /**
+    * @brief Compute fastest growing eigenmode
+    *
+    * The eigenvector is normalized to a unit maximum temperature
+    * coefficient.
+    *
+    * @param pol  Output poloidal Chebyshev expansion
+    * @param temp Output temperature Chebyshev expansion
+    * @param k1   First wave number
+    * @param k2   Second wave number
+    *
+    * @return Complex growth rate
+    */
+   MHDComplex fastest(ArrayZ& pol, ArrayZ& temp, const MHDFloat k1,
+      const MHDFloat k2) const;
+
+   /**
+    * @brief Build the parts of the linear operator
+    *
+    * The linear operator is the sum of the diffusion, the buoyancy and the
+    * advection of the conduction profile, a timestepper can treat each part
+    * implicitly or explicitly.
+    *
+    * @param B          Output time operator
+    * @param diffusion  Output diffusion with tau lines
+    * @param buoyancy   Output buoyancy in the poloidal equation
+    * @param advection  Output advection of the conduction profile
+    * @param k1         First wave number
+    * @param k2         Second wave number
+    */
+   void operators(SparseMatrix& B, SparseMatrix& diffusion,
+      SparseMatrix& buoyancy, SparseMatrix& advection, const MHDFloat k1,
+      const MHDFloat k2) const;
+
+protected:
+private:
+   /**
+    * @brief Build linear and time operator
+    *
+    * @param L    Output linear operator
+    * @param B    Output time operator
+    * @param k1   First wave number
+    * @param k2   Second wave number
+    */
+   void buildOperators(Matrix& L, Matrix& B, const MHDFloat k1,
+      const MHDFloat k2) const;
+
+   /**
+    * @brief Size of Chebyshev expansion
+    */
+   int mN;
+
+   /**
+    * @brief Lower boundary
+    */
+   Internal::MHDFloat mZi;
+
+   /**
+    * @brief Upper boundary
+    */
+   Internal::MHDFloat mZo;
+
+   /**
+    * @brief Rayleigh number
+    */
+   MHDFloat mRa;
+
+   /**
+    * @brief Prandtl number
+    */
+   MHDFloat mPr;
+
+   /**
+    * @brief Velocity boundary condition
+    */
+   std::size_t mVelBcId;
+
+   /**
+    * @brief Temperature boundary condition
+    */
+   std::size_t mTempBcId;
+
+   /**
+    * @brief Drop the last two columns of the no-slip poloidal time operator?
+    */
+   bool mDropQIColumns = false;
+};
+
+} // namespace RBC
+} // namespace Plane
+} // namespace Boussinesq
+} // namespace Model
+} // namespace QuICC
+
+#endif // QUICC_MODEL_BOUSSINESQ_PLANE_RBC_LINEARSTABILITY_HPP
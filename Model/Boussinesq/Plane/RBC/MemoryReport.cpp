@@ -0,0 +1,194 @@
+/**
+ * @file MemoryReport.cpp
+ * @brief Source of the operator memory footprint report of the RBC model
+ */
+
+// System includes
+//
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <vector>
+#ifdef QUICC_MPI
+#include <mpi.h>
+#endif // QUICC_MPI
+
+// Project includes
+//
+#include "Model/Boussinesq/Plane/RBC/MemoryReport.hpp"
+
+namespace QuICC {
+
+namespace Model {
+
+namespace Boussinesq {
+
+namespace Plane {
+
+namespace RBC {
+
+namespace {
+
+/**
+ * @brief Format bytes in MiB
+ *
+ * @param bytes   Storage in bytes
+ */
+double mib(const double bytes)
+{
+   return bytes / (1024.0 * 1024.0);
+}
+
+/**
+ * @brief MPI is active?
+ */
+bool isMpiActive()
+{
+#ifdef QUICC_MPI
+   int isInitialized = 0;
+   int isFinalized = 0;
+   MPI_Initialized(&isInitialized);
+   MPI_Finalized(&isFinalized);
+   return isInitialized && !isFinalized;
+#else
+   return false;
+#endif // QUICC_MPI
+}
+
+} // namespace
+
+MemoryReport::MemoryReport(const std::string& filename) :
+    mFilename(filename), mRank(0)
+{
+#ifdef QUICC_MPI
+   if (isMpiActive())
+   {
+      MPI_Comm_rank(MPI_COMM_WORLD, &this->mRank);
+   }
+#endif // QUICC_MPI
+}
+
+MemoryReport::~MemoryReport()
+{
+   if (this->mRank == 0)
+   {
+      std::ofstream out(this->mFilename);
+      this->write(out);
+   }
+   else
+   {
+      std::ostream null(nullptr);
+      this->write(null);
+   }
+}
+
+std::size_t MemoryReport::bytes(const SparseMatrix& mat)
+{
+   using Index = SparseMatrix::StorageIndex;
+   return mat.nonZeros() * (sizeof(SparseMatrix::Scalar) + sizeof(Index)) +
+          (mat.outerSize() + 1) * sizeof(Index);
+}
+
+void MemoryReport::addOperator(const std::string& opName,
+   const std::string& field, const int matIdx, const DecoupledZSparse& mat)
+{
+   std::lock_guard<std::mutex> lock(this->mMutex);
+
+   auto& s = this->mOperators[opName][std::make_pair(field, matIdx)];
+   s.nnz = mat.real().nonZeros() + mat.imag().nonZeros();
+   s.bytes = bytes(mat.real()) + bytes(mat.imag());
+}
+
+void MemoryReport::write(std::ostream& out) const
+{
+   std::lock_guard<std::mutex> lock(this->mMutex);
+
+   // Per rank totals: nonzero entries, bytes
+   std::vector<double> local(2, 0.0);
+   for (const auto& op: this->mOperators)
+   {
+      for (const auto& s: op.second)
+      {
+         local.at(0) += static_cast<double>(s.second.nnz);
+         local.at(1) += static_cast<double>(s.second.bytes);
+      }
+   }
+
+   int nRanks = 1;
+   std::vector<double> perRank = local;
+#ifdef QUICC_MPI
+   const bool isGathered = isMpiActive();
+   if (isGathered)
+   {
+      MPI_Comm_size(MPI_COMM_WORLD, &nRanks);
+      perRank.resize(2 * nRanks);
+      MPI_Gather(local.data(), 2, MPI_DOUBLE, perRank.data(), 2, MPI_DOUBLE,
+         0, MPI_COMM_WORLD);
+   }
+#endif // QUICC_MPI
+
+   if (this->mRank != 0)
+   {
+      return;
+   }
+
+   out << std::fixed << std::setprecision(3);
+   out << "# Operator memory footprint [MiB]" << std::endl;
+   out << "# Operators as built by the model backend, factorizations, fields"
+       << std::endl
+       << "# and transform scratch are owned by the framework" << std::endl;
+#ifdef QUICC_MPI
+   if (!isGathered)
+   {
+      out << "# MPI was finalized, only rank 0 is reported" << std::endl;
+   }
+#endif // QUICC_MPI
+
+   out << "#" << std::endl << "# Operators of rank 0" << std::endl;
+   out << "# " << std::setw(24) << "operator" << std::setw(10) << "blocks"
+       << std::setw(14) << "nnz" << std::setw(14) << "MiB" << std::endl;
+   for (const auto& op: this->mOperators)
+   {
+      std::size_t nnz = 0;
+      std::size_t b = 0;
+      for (const auto& s: op.second)
+      {
+         nnz += s.second.nnz;
+         b += s.second.bytes;
+      }
+      out << "  " << std::setw(24) << op.first << std::setw(10)
+          << op.second.size() << std::setw(14) << nnz << std::setw(14)
+          << mib(b) << std::endl;
+   }
+
+   out << "#" << std::endl << "# Summary per rank" << std::endl;
+   out << "# " << std::setw(6) << "rank" << std::setw(14) << "nnz"
+       << std::setw(14) << "MiB" << std::endl;
+   std::vector<double> sum(2, 0.0);
+   std::vector<double> max(2, 0.0);
+   for (int r = 0; r < nRanks; ++r)
+   {
+      for (int i = 0; i < 2; ++i)
+      {
+         sum.at(i) += perRank.at(2 * r + i);
+         max.at(i) = std::max(max.at(i), perRank.at(2 * r + i));
+      }
+      out << "  " << std::setw(6) << r << std::setw(14)
+          << std::setprecision(0) << perRank.at(2 * r) << std::setw(14)
+          << std::setprecision(3) << mib(perRank.at(2 * r + 1)) << std::endl;
+   }
+
+   out << "#" << std::endl << "# Global" << std::endl;
+   for (auto&& row: {std::make_pair("sum", &sum), std::make_pair("max", &max)})
+   {
+      out << "  " << std::setw(6) << row.first << std::setw(14)
+          << std::setprecision(0) << row.second->at(0) << std::setw(14)
+          << std::setprecision(3) << mib(row.second->at(1)) << std::endl;
+   }
+}
+
+} // namespace RBC
+} // namespace Plane
+} // namespace Boussinesq
+} // namespace Model
+} // namespace QuICC
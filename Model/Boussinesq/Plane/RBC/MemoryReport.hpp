@@ -0,0 +1,124 @@
+/**
+ * @file MemoryReport.hpp
+ * @brief Operator memory footprint report of the RBC model
+ */
+
+#ifndef QUICC_MODEL_BOUSSINESQ_PLANE_RBC_MEMORYREPORT_HPP
+#define QUICC_MODEL_BOUSSINESQ_PLANE_RBC_MEMORYREPORT_HPP
+
+// System includes
+//
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+
+// Project includes
+//
+#include "Types/Typedefs.hpp"
+
+namespace QuICC {
+
+namespace Model {
+
+namespace Boussinesq {
+
+namespace Plane {
+
+namespace RBC {
+
+/**
+ * @brief Operator memory footprint report of the RBC model
+ *
+ * Collects the nonzero entries and the compressed storage of every operator
+ * returned by modelMatrix and explicitBlock, as built. Operators are built
+ * while the framework sets up the equations and solvers, the report is
+ * therefore written when it is released with the model backend at the end
+ * of the run, summarized per rank and globally by the first rank. A run of a
+ * single timestep at the production resolution is enough to size a job.
+ *
+ * Factorizations, fields and transform scratch are owned by the framework
+ * and are not reported.
+ */
+class MemoryReport
+{
+public:
+   /**
+    * @brief Constructor
+    *
+    * @param filename   Name of the report file
+    */
+   explicit MemoryReport(const std::string& filename);
+
+   /**
+    * @brief Destructor, writes the report
+    *
+    * Collective over all ranks while MPI is active
+    */
+   ~MemoryReport();
+
+   MemoryReport(const MemoryReport&) = delete;
+   MemoryReport& operator=(const MemoryReport&) = delete;
+
+   /**
+    * @brief Record an operator block
+    *
+    * A rebuilt block replaces the previous one
+    *
+    * @param opName  Name of the operator ID
+    * @param field   Name of the field of the equation
+    * @param matIdx  Matrix index
+    * @param mat     Operator
+    */
+   void addOperator(const std::string& opName, const std::string& field,
+      const int matIdx, const DecoupledZSparse& mat);
+
+   /**
+    * @brief Write report
+    *
+    * Collective over all ranks while MPI is active, only the first rank
+    * writes.
+    *
+    * @param out  Output stream
+    */
+   void write(std::ostream& out) const;
+
+   /**
+    * @brief Storage of sparse matrix in compressed format
+    *
+    * @param mat  Sparse matrix
+    */
+   static std::size_t bytes(const SparseMatrix& mat);
+
+private:
+   /**
+    * @brief Storage of operator
+    */
+   struct OperatorStorage
+   {
+      /// Number of nonzero entries
+      std::size_t nnz = 0;
+      /// Storage in bytes
+      std::size_t bytes = 0;
+   };
+
+   /// Name of the report file
+   const std::string mFilename;
+   /// Rank at construction
+   int mRank;
+   /// Operator storage per operator name, field and matrix index
+   std::map<std::string, std::map<std::pair<std::string, int>, OperatorStorage>>
+      mOperators;
+   /// Operators can be built concurrently
+   mutable std::mutex mMutex;
+};
+
+} // namespace RBC
+} // namespace Plane
+} // namespace Boussinesq
+} // namespace Model
+} // namespace QuICC
+
+#endif // QUICC_MODEL_BOUSSINESQ_PLANE_RBC_MEMORYREPORT_HPP
@@ -0,0 +1,63 @@
+/**
+ * @file OperatorStore.cpp
+ * @brief Source of the storage of the k-independent operators
+ */
+
+// System includes
+//
+#include <sstream>
+
+// Project includes
+//
+#include "Model/Boussinesq/Plane/RBC/OperatorStore.hpp"
+
+namespace QuICC {
+
+namespace Model {
+
+namespace Boussinesq {
+
+namespace Plane {
+
+namespace RBC {
+
+std::string OperatorStore::key(const std::string& name, const int nN,
+   const MHDFloat zi, const MHDFloat zo, const std::vector<long>& ids)
+{
+   std::stringstream ss;
+   ss.precision(17);
+   ss << name << "_n" << nN << "_zi" << zi << "_zo" << zo;
+   for (auto id: ids)
+   {
+      ss << "_" << id;
+   }
+
+   return ss.str();
+}
+
+const SparseMatrix& OperatorStore::get(const std::string& key,
+   const Builder& builder)
+{
+   {
+      std::lock_guard<std::mutex> lock(this->mMutex);
+      auto it = this->mOperators.find(key);
+      if (it != this->mOperators.end())
+      {
+         return it->second;
+      }
+   }
+
+   // Build outside of the lock, concurrent builds of the same key are
+   // resolved on insertion
+   SparseMatrix mat = builder();
+   mat.makeCompressed();
+
+   std::lock_guard<std::mutex> lock(this->mMutex);
+   return this->mOperators.emplace(key, std::move(mat)).first->second;
+}
+
+} // namespace RBC
+} // namespace Plane
+} // namespace Boussinesq
+} // namespace Model
+} // namespace QuICC
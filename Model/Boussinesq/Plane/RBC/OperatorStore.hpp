@@ -0,0 +1,91 @@
+/**
+ * @file OperatorStore.hpp
+ * @brief Storage of the k-independent operators of the RBC model
+ */
+
+#ifndef QUICC_MODEL_BOUSSINESQ_PLANE_RBC_OPERATORSTORE_HPP
+#define QUICC_MODEL_BOUSSINESQ_PLANE_RBC_OPERATORSTORE_HPP
+
+// System includes
+//
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Project includes
+//
+#include "Types/Typedefs.hpp"
+
+namespace QuICC {
+
+namespace Model {
+
+namespace Boussinesq {
+
+namespace Plane {
+
+namespace RBC {
+
+/**
+ * @brief Storage of the k-independent operators of the RBC model
+ *
+ * Sparse operators that only depend on the resolution, the boundaries and
+ * the boundary conditions (tau lines, stencils, identities) are the same for
+ * all wave numbers. They are requested by key and built on the first request
+ * only.
+ */
+class OperatorStore
+{
+public:
+   /// Builder of an operator on its first request
+   typedef std::function<SparseMatrix()> Builder;
+
+   /**
+    * @brief Constructor
+    */
+   OperatorStore() = default;
+
+   /**
+    * @brief Destructor
+    */
+   ~OperatorStore() = default;
+
+   /**
+    * @brief Key of an operator
+    *
+    * @param name  Name of the operator
+    * @param nN    Size of Chebyshev expansion
+    * @param zi    Lower boundary
+    * @param zo    Upper boundary
+    * @param ids   Additional integer options (boundary condition, flags)
+    */
+   static std::string key(const std::string& name, const int nN,
+      const MHDFloat zi, const MHDFloat zo,
+      const std::vector<long>& ids = {});
+
+   /**
+    * @brief Operator of key, built on the first request
+    *
+    * Thread safe, the operator stays valid for the lifetime of the store
+    *
+    * @param key     Key of the operator
+    * @param builder Builder of the operator
+    */
+   const SparseMatrix& get(const std::string& key, const Builder& builder);
+
+private:
+   /// Operators
+   std::map<std::string, SparseMatrix> mOperators;
+   /// Lock of the operators
+   std::mutex mMutex;
+};
+
+} // namespace RBC
+} // namespace Plane
+} // namespace Boussinesq
+} // namespace Model
+} // namespace QuICC
+
+#endif // QUICC_MODEL_BOUSSINESQ_PLANE_RBC_OPERATORSTORE_HPP
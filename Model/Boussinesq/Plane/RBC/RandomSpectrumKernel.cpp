@@ -0,0 +1,143 @@
+/**
+ * @file RandomSpectrumKernel.cpp
+ * @brief Source of spectral kernel generating a reproducible random spectrum
+ */
+
+// System includes
+//
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+
+// Project includes
+//
+#include "Model/Boussinesq/Plane/RBC/RandomSpectrumKernel.hpp"
+#include "QuICC/Resolutions/Resolution.hpp"
+
+namespace QuICC {
+
+namespace Model {
+
+namespace Boussinesq {
+
+namespace Plane {
+
+namespace RBC {
+
+RandomSpectrumKernel::RandomSpectrumKernel(const bool isComplex) :
+    ISpectralKernel(isComplex),
+    mMin(-1.0),
+    mMax(1.0),
+    mRatio({1.0, 1.0, 1.0})
+{}
+
+void RandomSpectrumKernel::setRatio(const std::vector<MHDFloat>& ratio)
+{
+   assert(ratio.size() == 3);
+
+   this->mRatio = ratio;
+}
+
+void RandomSpectrumKernel::init(const MHDFloat minVal, const MHDFloat maxVal,
+   const std::uint64_t seed, const std::uint64_t stream)
+{
+   assert(minVal <= maxVal);
+
+   this->mMin = minVal;
+   this->mMax = maxVal;
+   this->mspRng = std::make_shared<CounterRng>(seed, stream);
+}
+
+MHDFloat RandomSpectrumKernel::decay(const int n, const int nMax,
+   const MHDFloat ratio) const
+{
+   if (nMax <= 0)
+   {
+      return 1.0;
+   }
+
+   return std::pow(ratio, -static_cast<MHDFloat>(n) / nMax);
+}
+
+MHDVariant RandomSpectrumKernel::compute(const int i, const int j,
+   const int k) const
+{
+   const auto& tRes = *this->res().cpu()->dim(Dimensions::Transform::SPECTRAL);
+
+   // Global spectral indexes
+   const int n = tRes.idx<Dimensions::Data::DAT1D>(i, k);
+   const int j_ = tRes.idx<Dimensions::Data::DAT2D>(j, k);
+   const int k_ = tRes.idx<Dimensions::Data::DAT3D>(k);
+
+   // Spectral sizes: slow index is the real-to-complex Fourier direction,
+   // middle index the complex Fourier direction storing negative wave numbers
+   // after the positive ones
+   const int nN = this->res().sim().dim(Dimensions::Simulation::SIM1D,
+      Dimensions::Space::SPECTRAL);
+   const int nJ = this->res().sim().dim(Dimensions::Simulation::SIM3D,
+      Dimensions::Space::SPECTRAL);
+   const int nK = this->res().sim().dim(Dimensions::Simulation::SIM2D,
+      Dimensions::Space::SPECTRAL);
+
+   const auto c = this->coefficient(n, j_, k_, nN, nJ, nK);
+   if (this->mIsComplex)
+   {
+      return c;
+   }
+   else
+   {
+      return c.real();
+   }
+}
+
+MHDComplex RandomSpectrumKernel::coefficient(const int n, const int j,
+   const int k, const int nN, const int nJ, const int nK) const
+{
+   assert(this->mspRng);
+   assert(n >= 0 && n < nN);
+   assert(j >= 0 && j < nJ);
+   assert(k >= 0 && k < nK);
+
+   // Signed wave number of the complex direction
+   const int kJ = (j <= (nJ - 1) / 2) ? j : j - nJ;
+
+   // On the k = 0 plane, negative wave numbers are the complex conjugate of
+   // the positive ones, the zero and Nyquist wave numbers are their own
+   // conjugate and therefore real
+   int jKey = j;
+   MHDFloat conj = 1.0;
+   bool isReal = false;
+   if (k == 0)
+   {
+      if (kJ < 0)
+      {
+         jKey = -kJ;
+         conj = -1.0;
+      }
+      isReal = (kJ == 0 || 2 * kJ == -nJ);
+   }
+
+   const MHDFloat scale = this->decay(n, nN - 1, this->mRatio.at(0)) *
+                          this->decay(std::abs(kJ), nJ / 2, this->mRatio.at(1)) *
+                          this->decay(k, nK - 1, this->mRatio.at(2));
+
+   const MHDFloat re =
+      scale * this->mspRng->uniform(CounterRng::counter(n, jKey, k, 0),
+                 this->mMin, this->mMax);
+
+   MHDFloat im = 0.0;
+   if (!isReal)
+   {
+      im = conj * scale *
+           this->mspRng->uniform(CounterRng::counter(n, jKey, k, 1), this->mMin,
+              this->mMax);
+   }
+
+   return MHDComplex(re, im);
+}
+
+} // namespace RBC
+} // namespace Plane
+} // namespace Boussinesq
+} // namespace Model
+} // namespace QuICC
@@ -0,0 +1,139 @@
+/**
+ * @file RandomSpectrumKernel.hpp
+ * @brief Spectral kernel generating a reproducible random spectrum
+ */
+
+#ifndef QUICC_MODEL_BOUSSINESQ_PLANE_RBC_RANDOMSPECTRUMKERNEL_HPP
+#define QUICC_MODEL_BOUSSINESQ_PLANE_RBC_RANDOMSPECTRUMKERNEL_HPP
+
+// System includes
+//
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Project includes
+//
+#include "Model/Boussinesq/Plane/RBC/CounterRng.hpp"
+#include "QuICC/SpectralKernels/ISpectralKernel.hpp"
+
+namespace QuICC {
+
+namespace Model {
+
+namespace Boussinesq {
+
+namespace Plane {
+
+namespace RBC {
+
+/**
+ * @brief Spectral kernel generating a reproducible random spectrum
+ *
+ * Spectral coefficients are filled directly from a counter-based generator
+ * keyed on the global spectral index. The generated state is therefore
+ * identical for any MPI decomposition and no physical space transform is
+ * required.
+ */
+class RandomSpectrumKernel : public Spectral::Kernel::ISpectralKernel
+{
+public:
+   /**
+    * @brief Simple constructor
+    *
+    * @param isComplex  Spectrum is complex?
+    */
+   explicit RandomSpectrumKernel(const bool isComplex);
+
+   /**
+    * @brief Simple empty destructor
+    */
+   virtual ~RandomSpectrumKernel() = default;
+
+   /**
+    * @brief Set spectral decay ratio between first and last mode
+    *
+    * @param ratio   Ratio for each dimension
+    */
+   void setRatio(const std::vector<MHDFloat>& ratio);
+
+   /**
+    * @brief Initialize kernel
+    *
+    * @param minVal  Minimum value
+    * @param maxVal  Maximum value
+    * @param seed    Seed of the generator
+    * @param stream  Stream ID (use different ID for each field component)
+    */
+   void init(const MHDFloat minVal, const MHDFloat maxVal,
+      const std::uint64_t seed, const std::uint64_t stream);
+
+   /**
+    * @brief Compute the spectral kernel
+    *
+    * @param i Fast index
+    * @param j Middle index
+    * @param k Slow index
+    */
+   virtual MHDVariant compute(const int i, const int j,
+      const int k) const override;
+
+   /**
+    * @brief Coefficient of a global spectral index
+    *
+    * On the k = 0 plane the coefficients of negative wave numbers are the
+    * complex conjugates of the positive ones, and the zero and Nyquist wave
+    * numbers are real, so that the physical field is real.
+    *
+    * @param n    Global index of the Chebyshev direction
+    * @param j    Global index of the complex Fourier direction
+    * @param k    Global index of the real-to-complex Fourier direction
+    * @param nN   Spectral size of the Chebyshev direction
+    * @param nJ   Spectral size of the complex Fourier direction
+    * @param nK   Spectral size of the real-to-complex Fourier direction
+    */
+   MHDComplex coefficient(const int n, const int j, const int k, const int nN,
+      const int nJ, const int nK) const;
+
+protected:
+private:
+   /**
+    * @brief Spectral decay factor
+    *
+    * @param n       Index of mode
+    * @param nMax    Largest index
+    * @param ratio   Ratio between first and last mode
+    */
+   MHDFloat decay(const int n, const int nMax, const MHDFloat ratio) const;
+
+   /**
+    * @brief Minimum value
+    */
+   MHDFloat mMin;
+
+   /**
+    * @brief Maximum value
+    */
+   MHDFloat mMax;
+
+   /**
+    * @brief Spectral ratios
+    */
+   std::vector<MHDFloat> mRatio;
+
+   /**
+    * @brief Counter-based generator
+    */
+   std::shared_ptr<CounterRng> mspRng;
+};
+
+/// Typedef for a smart RandomSpectrumKernel
+typedef std::shared_ptr<RandomSpectrumKernel> SharedRandomSpectrumKernel;
+
+} // namespace RBC
+} // namespace Plane
+} // namespace Boussinesq
+} // namespace Model
+} // namespace QuICC
+
+#endif // QUICC_MODEL_BOUSSINESQ_PLANE_RBC_RANDOMSPECTRUMKERNEL_HPP
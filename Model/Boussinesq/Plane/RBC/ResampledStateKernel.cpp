@@ -0,0 +1,434 @@
+/**
+ * @file ResampledStateKernel.cpp
+ * @brief Source of spectral kernel resampling a state file
+ */
+
+// System includes
+//
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <fstream>
+#include <hdf5.h>
+#include <iomanip>
+#include <set>
+#include <stdexcept>
+#include <string>
+#ifdef QUICC_MPI
+#include <mpi.h>
+#endif // QUICC_MPI
+
+// Project includes
+//
+#include "Model/Boussinesq/Plane/RBC/ResampledStateKernel.hpp"
+#include "Model/Boussinesq/Plane/RBC/IRBCBackend.hpp"
+#include "Model/Boussinesq/Plane/RBC/StateResampler.hpp"
+#include "QuICC/PhysicalNames/Velocity.hpp"
+#include "QuICC/Resolutions/Resolution.hpp"
+
+namespace QuICC {
+
+namespace Model {
+
+namespace Boussinesq {
+
+namespace Plane {
+
+namespace RBC {
+
+namespace {
+
+/**
+ * @brief HDF5 identifier closed when going out of scope
+ */
+class H5Id
+{
+public:
+   /**
+    * @brief Constructor
+    *
+    * @param id      HDF5 identifier, negative if invalid
+    * @param close   Function closing the identifier
+    */
+   H5Id(const hid_t id, herr_t (*close)(hid_t)) : mId(id), mClose(close) {}
+
+   /**
+    * @brief Destructor, closes valid identifier
+    */
+   ~H5Id()
+   {
+      if (this->mId >= 0)
+      {
+         this->mClose(this->mId);
+      }
+   }
+
+   H5Id(const H5Id&) = delete;
+   H5Id& operator=(const H5Id&) = delete;
+
+   /**
+    * @brief HDF5 identifier
+    */
+   hid_t id() const
+   {
+      return this->mId;
+   }
+
+private:
+   /// HDF5 identifier
+   const hid_t mId;
+   /// Function closing the identifier
+   herr_t (*mClose)(hid_t);
+};
+
+/**
+ * @brief Throw if HDF5 call failed
+ *
+ * @param status  Return value of the HDF5 call
+ * @param msg     Error message
+ */
+void check(const long status, const std::string& msg)
+{
+   if (status < 0)
+   {
+      throw std::logic_error(msg);
+   }
+}
+
+} // namespace
+
+ResampledStateKernel::ResampledStateKernel(const bool isComplex) :
+    ISpectralKernel(isComplex),
+    mBcId(0),
+    mZi(0),
+    mZo(0),
+    mUseSplitEquation(false),
+    mNRanks(1),
+    mModesRead(0),
+    mBytesRead(0),
+    mReadTime(0),
+    mNN(0)
+{}
+
+void ResampledStateKernel::init(const std::string& filename,
+   const std::string& dataset, const SpectralFieldId& fId,
+   const std::size_t bcId, const Internal::MHDFloat zi,
+   const Internal::MHDFloat zo, const bool useSplitEquation,
+   const Resolution& res)
+{
+   this->mFilename = filename;
+   this->mDataset = dataset;
+   this->mFieldId = fId;
+   this->mBcId = bcId;
+   this->mZi = zi;
+   this->mZo = zo;
+   this->mUseSplitEquation = useSplitEquation;
+
+   this->mFileDims.clear();
+   this->mData.clear();
+   this->mOffsets.clear();
+   this->mSlabOffsets.clear();
+
+   // All ranks reach the reductions, also if the read failed on some ranks
+   auto start = std::chrono::steady_clock::now();
+   std::string error;
+   try
+   {
+      this->load(res);
+   }
+   catch (const std::exception& e)
+   {
+      error = e.what();
+   }
+   std::chrono::duration<double> t = std::chrono::steady_clock::now() - start;
+
+   int hasFailed = !error.empty();
+#ifdef QUICC_MPI
+   MPI_Allreduce(MPI_IN_PLACE, &hasFailed, 1, MPI_INT, MPI_MAX,
+      MPI_COMM_WORLD);
+#endif // QUICC_MPI
+   if (hasFailed)
+   {
+      if (error.empty())
+      {
+         error = "Could not read " + this->mDataset + " from " +
+                 this->mFilename + " on another rank";
+      }
+      throw std::logic_error(error);
+   }
+
+   this->reduceStatistics(this->mOffsets.size(),
+      this->mData.size() * sizeof(MHDComplex), t.count());
+
+   this->resample(res);
+
+   // Stored modes are no longer needed
+   std::vector<MHDComplex>().swap(this->mData);
+   this->mOffsets.clear();
+}
+
+void ResampledStateKernel::load(const Resolution& res)
+{
+   // File is opened through MPI-IO and read collectively
+   H5Id fapl(H5Pcreate(H5P_FILE_ACCESS), H5Pclose);
+   check(fapl.id(), "Could not create file access property list");
+   H5Id dxpl(H5Pcreate(H5P_DATASET_XFER), H5Pclose);
+   check(dxpl.id(), "Could not create transfer property list");
+#ifdef QUICC_MPI
+   check(H5Pset_fapl_mpio(fapl.id(), MPI_COMM_WORLD, MPI_INFO_NULL),
+      "Could not set MPI-IO file access");
+   check(H5Pset_dxpl_mpio(dxpl.id(), H5FD_MPIO_COLLECTIVE),
+      "Could not set collective transfer");
+#endif // QUICC_MPI
+
+   H5Id file(H5Fopen(this->mFilename.c_str(), H5F_ACC_RDONLY, fapl.id()),
+      H5Fclose);
+   check(file.id(), "Could not open state file " + this->mFilename);
+
+   H5Id dset(H5Dopen(file.id(), this->mDataset.c_str(), H5P_DEFAULT),
+      H5Dclose);
+   check(dset.id(),
+      "Dataset " + this->mDataset + " not found in " + this->mFilename);
+
+   // Stored as regular 3D array: real-to-complex Fourier, complex Fourier,
+   // Chebyshev
+   H5Id fspace(H5Dget_space(dset.id()), H5Sclose);
+   check(fspace.id(), "Could not get dataspace of " + this->mDataset);
+   if (H5Sget_simple_extent_ndims(fspace.id()) != 3)
+   {
+      throw std::logic_error("Unexpected layout of dataset " + this->mDataset);
+   }
+   hsize_t dims[3];
+   check(H5Sget_simple_extent_dims(fspace.id(), dims, nullptr),
+      "Could not get dimensions of " + this->mDataset);
+   this->mFileDims = {static_cast<int>(dims[0]), static_cast<int>(dims[1]),
+      static_cast<int>(dims[2])};
+   const int nKf = this->mFileDims.at(0);
+   const int nJf = this->mFileDims.at(1);
+   const int nNf = this->mFileDims.at(2);
+
+   // Stored modes needed by the local spectral modes, ordered as in the file
+   const auto& tRes = *res.cpu()->dim(Dimensions::Transform::SPECTRAL);
+   const int nJ = res.sim().dim(Dimensions::Simulation::SIM3D,
+      Dimensions::Space::SPECTRAL);
+   const int nK = res.sim().dim(Dimensions::Simulation::SIM2D,
+      Dimensions::Space::SPECTRAL);
+   std::set<std::pair<int, int>> stored;
+   for (int k = 0; k < tRes.dim<Dimensions::Data::DAT3D>(); ++k)
+   {
+      const int k_ = tRes.idx<Dimensions::Data::DAT3D>(k);
+      const int kf = StateResampler::mapIndex(k_, nKf, nK, false);
+      for (int j = 0; j < tRes.dim<Dimensions::Data::DAT2D>(k) && kf >= 0; ++j)
+      {
+         const int j_ = tRes.idx<Dimensions::Data::DAT2D>(j, k);
+         const int jf = StateResampler::mapIndex(j_, nJf, nJ, true);
+         if (jf >= 0)
+         {
+            stored.emplace(kf, jf);
+         }
+      }
+   }
+
+   // Union of hyperslabs, one per contiguous run of stored j at fixed k
+   check(H5Sselect_none(fspace.id()), "Could not clear selection");
+   std::size_t offset = 0;
+   for (auto it = stored.begin(); it != stored.end();)
+   {
+      auto last = it;
+      auto next = std::next(it);
+      while (next != stored.end() && next->first == it->first &&
+             next->second == last->second + 1)
+      {
+         last = next;
+         ++next;
+      }
+
+      hsize_t fStart[3] = {static_cast<hsize_t>(it->first),
+         static_cast<hsize_t>(it->second), 0};
+      hsize_t fCount[3] = {1,
+         static_cast<hsize_t>(last->second - it->second + 1),
+         static_cast<hsize_t>(nNf)};
+      check(H5Sselect_hyperslab(fspace.id(), H5S_SELECT_OR, fStart, nullptr,
+               fCount, nullptr),
+         "Could not select modes of " + this->mDataset);
+
+      for (; it != next; ++it)
+      {
+         this->mOffsets.emplace(*it, offset);
+         offset += nNf;
+      }
+   }
+
+   // Complex values are stored as compound type
+   H5Id ctype(H5Tcreate(H5T_COMPOUND, sizeof(MHDComplex)), H5Tclose);
+   check(ctype.id(), "Could not create complex type");
+   check(H5Tinsert(ctype.id(), "r", 0, H5T_NATIVE_DOUBLE),
+      "Could not create complex type");
+   check(H5Tinsert(ctype.id(), "i", sizeof(double), H5T_NATIVE_DOUBLE),
+      "Could not create complex type");
+
+   // Ranks without stored modes take part in the collective read with an
+   // empty selection
+   this->mData.resize(std::max<std::size_t>(offset, 1));
+   hsize_t mDims[1] = {static_cast<hsize_t>(this->mData.size())};
+   H5Id mspace(H5Screate_simple(1, mDims, nullptr), H5Sclose);
+   check(mspace.id(), "Could not create memory space");
+   if (offset == 0)
+   {
+      check(H5Sselect_none(mspace.id()), "Could not clear selection");
+   }
+   check(H5Dread(dset.id(), ctype.id(), mspace.id(), fspace.id(), dxpl.id(),
+            this->mData.data()),
+      "Could not read " + this->mDataset + " from " + this->mFilename);
+   this->mData.resize(offset);
+}
+
+void ResampledStateKernel::reduceStatistics(const std::size_t nModes,
+   const std::size_t bytes, const double seconds)
+{
+   double sum[2] = {static_cast<double>(nModes), static_cast<double>(bytes)};
+   double tMax = seconds;
+   int nRanks = 1;
+#ifdef QUICC_MPI
+   MPI_Comm_size(MPI_COMM_WORLD, &nRanks);
+   MPI_Allreduce(MPI_IN_PLACE, sum, 2, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+   MPI_Allreduce(MPI_IN_PLACE, &tMax, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+#endif // QUICC_MPI
+
+   this->mNRanks = nRanks;
+   this->mModesRead = static_cast<std::size_t>(sum[0]);
+   this->mBytesRead = static_cast<std::size_t>(sum[1]);
+   this->mReadTime = tMax;
+}
+
+void ResampledStateKernel::writeReport(const std::string& filename,
+   const std::vector<std::shared_ptr<ResampledStateKernel>>& kernels)
+{
+   int rank = 0;
+#ifdef QUICC_MPI
+   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif // QUICC_MPI
+   if (rank != 0 || kernels.empty())
+   {
+      return;
+   }
+
+   std::ofstream out(filename);
+   out << "# Hyperslab read of " << kernels.front()->mFilename << std::endl;
+   out << "# " << std::setw(24) << "dataset" << std::setw(8) << "ranks"
+       << std::setw(12) << "modes" << std::setw(12) << "MiB" << std::setw(12)
+       << "max [s]" << std::setw(12) << "MiB/s" << std::endl;
+
+   out << std::fixed << std::setprecision(3);
+   for (const auto& spKernel: kernels)
+   {
+      const auto& k = *spKernel;
+      const double mib = k.mBytesRead / (1024.0 * 1024.0);
+      out << "  " << std::setw(24) << k.mDataset << std::setw(8) << k.mNRanks
+          << std::setw(12) << k.mModesRead << std::setw(12) << mib
+          << std::setw(12) << k.mReadTime << std::setw(12)
+          << ((k.mReadTime > 0) ? mib / k.mReadTime : 0.0) << std::endl;
+   }
+}
+
+std::vector<SparseMatrix> ResampledStateKernel::boundaryOperators(
+   const int nN, const bool isMean) const
+{
+   std::vector<SparseMatrix> ops;
+   ops.push_back(IRBCBackend::tauOperator(this->mFieldId, nN, this->mZi,
+      this->mZo, this->mBcId, isMean, this->mUseSplitEquation, false));
+
+   if (this->mUseSplitEquation &&
+       this->mFieldId == std::make_pair(PhysicalNames::Velocity::id(),
+                            FieldComponents::Spectral::POL))
+   {
+      ops.push_back(IRBCBackend::tauOperator(this->mFieldId, nN, this->mZi,
+         this->mZo, this->mBcId, isMean, this->mUseSplitEquation, true));
+   }
+
+   return ops;
+}
+
+void ResampledStateKernel::resample(const Resolution& res)
+{
+   const auto& tRes = *res.cpu()->dim(Dimensions::Transform::SPECTRAL);
+   const int nN = res.sim().dim(Dimensions::Simulation::SIM1D,
+      Dimensions::Space::SPECTRAL);
+   const int nJ = res.sim().dim(Dimensions::Simulation::SIM3D,
+      Dimensions::Space::SPECTRAL);
+   const int nK = res.sim().dim(Dimensions::Simulation::SIM2D,
+      Dimensions::Space::SPECTRAL);
+
+   const int nKf = this->mFileDims.at(0);
+   const int nJf = this->mFileDims.at(1);
+   const int nNf = this->mFileDims.at(2);
+
+   // Only the mean mode has different boundary conditions
+   StateResampler meanResampler(nNf, nN);
+   meanResampler.setBoundary(this->boundaryOperators(nN, true));
+   StateResampler resampler(nNf, nN);
+   resampler.setBoundary(this->boundaryOperators(nN, false));
+
+   const int nSlabs = tRes.dim<Dimensions::Data::DAT3D>();
+   this->mNN = nN;
+   this->mSlabOffsets.assign(nSlabs + 1, 0);
+   for (int k = 0; k < nSlabs; ++k)
+   {
+      this->mSlabOffsets.at(k + 1) = this->mSlabOffsets.at(k) +
+                                     tRes.dim<Dimensions::Data::DAT2D>(k) * nN;
+   }
+   this->mModes = ArrayZ::Zero(this->mSlabOffsets.back());
+
+   // Modes missing from the file stay zero
+   for (int k = 0; k < nSlabs; ++k)
+   {
+      const int k_ = tRes.idx<Dimensions::Data::DAT3D>(k);
+      const int kf = StateResampler::mapIndex(k_, nKf, nK, false);
+      for (int j = 0; j < tRes.dim<Dimensions::Data::DAT2D>(k); ++j)
+      {
+         const int j_ = tRes.idx<Dimensions::Data::DAT2D>(j, k);
+         const int jf = StateResampler::mapIndex(j_, nJf, nJ, true);
+         auto it = this->mOffsets.find(std::make_pair(kf, jf));
+         if (it != this->mOffsets.end())
+         {
+            Eigen::Map<const ArrayZ> in(this->mData.data() + it->second, nNf);
+            auto out =
+               this->mModes.segment(this->mSlabOffsets.at(k) + j * nN, nN);
+            const bool isMean = (k_ == 0 && j_ == 0);
+            if (isMean)
+            {
+               meanResampler.resample(out, in);
+            }
+            else
+            {
+               resampler.resample(out, in);
+            }
+         }
+      }
+   }
+}
+
+MHDVariant ResampledStateKernel::compute(const int i, const int j,
+   const int k) const
+{
+   const auto& tRes = *this->res().cpu()->dim(Dimensions::Transform::SPECTRAL);
+
+   // Global Chebyshev index
+   const int n = tRes.idx<Dimensions::Data::DAT1D>(i, k);
+
+   const auto& c = this->mModes(this->mSlabOffsets.at(k) + j * this->mNN + n);
+   if (this->mIsComplex)
+   {
+      return c;
+   }
+   else
+   {
+      return c.real();
+   }
+}
+
+} // namespace RBC
+} // namespace Plane
+} // namespace Boussinesq
+} // namespace Model
+} // namespace QuICC
@@ -0,0 +1,245 @@
+/**
+ * @file ResampledStateKernel.hpp
+ * @brief Spectral kernel resampling a state file to the current resolution
+ */
+
+#ifndef QUICC_MODEL_BOUSSINESQ_PLANE_RBC_RESAMPLEDSTATEKERNEL_HPP
+#define QUICC_MODEL_BOUSSINESQ_PLANE_RBC_RESAMPLEDSTATEKERNEL_HPP
+
+// System includes
+//
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Project includes
+//
+#include "QuICC/Enums/FieldIds.hpp"
+#include "QuICC/Resolutions/Resolution.hpp"
+#include "QuICC/SpectralKernels/ISpectralKernel.hpp"
+#include "Types/Internal/BasicTypes.hpp"
+#include "Types/Typedefs.hpp"
+
+namespace QuICC {
+
+namespace Model {
+
+namespace Boussinesq {
+
+namespace Plane {
+
+namespace RBC {
+
+/**
+ * @brief Spectral kernel resampling a state file to the current resolution
+ *
+ * The field is read from a state file written by StateFileWriter at any
+ * Chebyshev x Fourier resolution. Fourier modes are padded or dropped,
+ * the Chebyshev expansion is padded or truncated and the boundary conditions
+ * are restored through StateResampler.
+ *
+ * Each rank reads only the stored modes its local spectral modes map to,
+ * through a hyperslab selection in the file. The selection is built from the
+ * global mode indexes and is therefore independent of the decomposition the
+ * file was written with. The file is opened through MPI-IO and all ranks
+ * take part in one collective read. The stored modes are read and resampled
+ * by init, which is collective over all ranks, compute only looks up the
+ * result.
+ *
+ * Only the field is restored, the simulation time and timestep of the
+ * stored state are not carried over and the generated state starts at
+ * t = 0.
+ */
+class ResampledStateKernel : public Spectral::Kernel::ISpectralKernel
+{
+public:
+   /**
+    * @brief Simple constructor
+    *
+    * @param isComplex  Spectrum is complex?
+    */
+   explicit ResampledStateKernel(const bool isComplex);
+
+   /**
+    * @brief Simple empty destructor
+    */
+   virtual ~ResampledStateKernel() = default;
+
+   /**
+    * @brief Initialize kernel, read and resample the stored modes
+    *
+    * Collective over all ranks, kernels have to be initialized in the same
+    * order on all ranks
+    *
+    * @param filename   Name of the state file
+    * @param dataset    Path of the dataset in the state file
+    * @param fId        Field ID
+    * @param bcId       Boundary condition ID
+    * @param zi         Lower boundary
+    * @param zo         Upper boundary
+    * @param useSplitEquation Poloidal equation is split into two systems?
+    * @param res        Resolution of the generated state
+    */
+   void init(const std::string& filename, const std::string& dataset,
+      const SpectralFieldId& fId, const std::size_t bcId,
+      const Internal::MHDFloat zi, const Internal::MHDFloat zo,
+      const bool useSplitEquation, const Resolution& res);
+
+   /**
+    * @brief Write aggregate read statistics of kernels
+    *
+    * Only written by the first rank
+    *
+    * @param filename   Name of the output file
+    * @param kernels    Initialized kernels
+    */
+   static void writeReport(const std::string& filename,
+      const std::vector<std::shared_ptr<ResampledStateKernel>>& kernels);
+
+   /**
+    * @brief Compute the spectral kernel
+    *
+    * @param i Fast index
+    * @param j Middle index
+    * @param k Slow index
+    */
+   virtual MHDVariant compute(const int i, const int j,
+      const int k) const override;
+
+protected:
+private:
+   /**
+    * @brief Read stored modes needed by the local spectral modes
+    *
+    * @param res  Resolution of the generated state
+    */
+   void load(const Resolution& res);
+
+   /**
+    * @brief Reduce read statistics over all ranks
+    *
+    * @param nModes   Number of stored modes read by this rank
+    * @param bytes    Bytes read by this rank
+    * @param seconds  Wall time of the read on this rank
+    */
+   void reduceStatistics(const std::size_t nModes, const std::size_t bytes,
+      const double seconds);
+
+   /**
+    * @brief Tau operators holding all boundary conditions of the field
+    *
+    * For the split poloidal equation the conditions are distributed over
+    * both operators of the split system
+    *
+    * @param nN      Size of Chebyshev expansion
+    * @param isMean  Operators are for the k1 = k2 = 0 mean mode?
+    */
+   std::vector<SparseMatrix> boundaryOperators(const int nN,
+      const bool isMean) const;
+
+   /**
+    * @brief Resample the stored modes needed by the local spectral modes
+    *
+    * @param res  Resolution of the generated state
+    */
+   void resample(const Resolution& res);
+
+   /**
+    * @brief Name of the state file
+    */
+   std::string mFilename;
+
+   /**
+    * @brief Path of the dataset
+    */
+   std::string mDataset;
+
+   /**
+    * @brief Field ID
+    */
+   SpectralFieldId mFieldId;
+
+   /**
+    * @brief Boundary condition ID
+    */
+   std::size_t mBcId;
+
+   /**
+    * @brief Lower boundary
+    */
+   Internal::MHDFloat mZi;
+
+   /**
+    * @brief Upper boundary
+    */
+   Internal::MHDFloat mZo;
+
+   /**
+    * @brief Poloidal equation is split into two systems?
+    */
+   bool mUseSplitEquation;
+
+   /**
+    * @brief Dimensions of stored field (slow to fast)
+    */
+   std::vector<int> mFileDims;
+
+   /**
+    * @brief Stored modes read by this rank
+    */
+   std::vector<MHDComplex> mData;
+
+   /**
+    * @brief Offset in mData of stored modes (stored k, stored j)
+    */
+   std::map<std::pair<int, int>, std::size_t> mOffsets;
+
+   /**
+    * @brief Number of ranks that read the stored modes
+    */
+   int mNRanks;
+
+   /**
+    * @brief Stored modes read by all ranks
+    */
+   std::size_t mModesRead;
+
+   /**
+    * @brief Bytes read by all ranks
+    */
+   std::size_t mBytesRead;
+
+   /**
+    * @brief Maximum read time over all ranks
+    */
+   double mReadTime;
+
+   /**
+    * @brief Size of the resampled Chebyshev expansion
+    */
+   int mNN;
+
+   /**
+    * @brief Resampled local modes, one expansion per local (k, j)
+    */
+   ArrayZ mModes;
+
+   /**
+    * @brief Offset in mModes of the first mode of each local slow index
+    */
+   std::vector<std::size_t> mSlabOffsets;
+};
+
+/// Typedef for a smart ResampledStateKernel
+typedef std::shared_ptr<ResampledStateKernel> SharedResampledStateKernel;
+
+} // namespace RBC
+} // namespace Plane
+} // namespace Boussinesq
+} // namespace Model
+} // namespace QuICC
+
+#endif // QUICC_MODEL_BOUSSINESQ_PLANE_RBC_RESAMPLEDSTATEKERNEL_HPP
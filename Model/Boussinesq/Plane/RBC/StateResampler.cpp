@@ -0,0 +1,129 @@
+/**
+ * @file StateResampler.cpp
+ * @brief Source of the spectral prolongation/restriction of states
+ */
+
+// System includes
+//
+#include <algorithm>
+#include <cassert>
+#include <map>
+#include <stdexcept>
+#include <utility>
+
+// Project includes
+//
+#include "Model/Boussinesq/Plane/RBC/StateResampler.hpp"
+
+namespace QuICC {
+
+namespace Model {
+
+namespace Boussinesq {
+
+namespace Plane {
+
+namespace RBC {
+
+StateResampler::StateResampler(const int nIn, const int nOut) :
+    mNIn(nIn), mNOut(nOut), mBc(0, nOut)
+{}
+
+void StateResampler::setBoundary(const std::vector<SparseMatrix>& tau)
+{
+   // Collect nonzero rows of tau operators, in row order of each operator
+   std::vector<Matrix> rows;
+   for (const auto& t: tau)
+   {
+      assert(t.cols() == this->mNOut);
+      std::map<int, Matrix> tRows;
+      for (int c = 0; c < t.outerSize(); ++c)
+      {
+         for (SparseMatrix::InnerIterator it(t, c); it; ++it)
+         {
+            if (it.value() != 0.0)
+            {
+               auto r = tRows.find(it.row());
+               if (r == tRows.end())
+               {
+                  r = tRows.emplace(it.row(), Matrix::Zero(1, this->mNOut))
+                         .first;
+               }
+               r->second(0, it.col()) = it.value();
+            }
+         }
+      }
+
+      for (auto& r: tRows)
+      {
+         rows.push_back(std::move(r.second));
+      }
+   }
+
+   const int nBc = rows.size();
+   if (nBc > this->mNOut)
+   {
+      throw std::logic_error(
+         "Resolution too small to impose boundary conditions");
+   }
+
+   this->mBc.resize(nBc, this->mNOut);
+   for (int r = 0; r < nBc; ++r)
+   {
+      this->mBc.row(r) = rows.at(r);
+   }
+
+   if (nBc > 0)
+   {
+      this->mTailLu.compute(this->mBc.rightCols(nBc));
+   }
+}
+
+void StateResampler::resample(Eigen::Ref<ArrayZ> out,
+   const Eigen::Ref<const ArrayZ>& in) const
+{
+   assert(in.size() == this->mNIn);
+   assert(out.size() == this->mNOut);
+
+   const int nC = std::min(this->mNIn, this->mNOut);
+   out.setZero();
+   out.head(nC) = in.head(nC);
+
+   // Restore boundary conditions by correcting the last coefficients
+   const int nBc = this->mBc.rows();
+   if (nBc > 0)
+   {
+      Matrix rRe = this->mBc * out.real();
+      Matrix rIm = this->mBc * out.imag();
+      out.tail(nBc).real() -= this->mTailLu.solve(rRe);
+      out.tail(nBc).imag() -= this->mTailLu.solve(rIm);
+   }
+}
+
+int StateResampler::waveNumber(const int idx, const int n)
+{
+   return (idx <= (n - 1) / 2) ? idx : idx - n;
+}
+
+int StateResampler::mapIndex(const int idx, const int nIn, const int nOut,
+   const bool hasNeg)
+{
+   if (!hasNeg)
+   {
+      return (idx < nIn) ? idx : -1;
+   }
+
+   const int k = waveNumber(idx, nOut);
+   if (k > (nIn - 1) / 2 || k < -(nIn / 2))
+   {
+      return -1;
+   }
+
+   return (k >= 0) ? k : nIn + k;
+}
+
+} // namespace RBC
+} // namespace Plane
+} // namespace Boussinesq
+} // namespace Model
+} // namespace QuICC
@@ -0,0 +1,124 @@
+/**
+ * @file StateResampler.hpp
+ * @brief Spectral prolongation/restriction of Chebyshev x Fourier states
+ */
+
+#ifndef QUICC_MODEL_BOUSSINESQ_PLANE_RBC_STATERESAMPLER_HPP
+#define QUICC_MODEL_BOUSSINESQ_PLANE_RBC_STATERESAMPLER_HPP
+
+// System includes
+//
+#include <vector>
+
+// Project includes
+//
+#include "Types/Typedefs.hpp"
+
+namespace QuICC {
+
+namespace Model {
+
+namespace Boussinesq {
+
+namespace Plane {
+
+namespace RBC {
+
+/**
+ * @brief Spectral prolongation/restriction of Chebyshev x Fourier states
+ *
+ * State files store the full Chebyshev expansion, independently of the tau
+ * or Galerkin scheme used by the solver. Prolongation pads with zeros which
+ * preserves the boundary conditions exactly. Restriction truncates the
+ * expansion and then corrects the highest coefficients (tau convention) such
+ * that the boundary conditions hold again at the new resolution. The
+ * corrected expansion lies in the range of the Galerkin stencil and can be
+ * used with either scheme.
+ */
+class StateResampler
+{
+public:
+   /**
+    * @brief Constructor
+    *
+    * @param nIn  Size of input Chebyshev expansion
+    * @param nOut Size of output Chebyshev expansion
+    */
+   StateResampler(const int nIn, const int nOut);
+
+   /**
+    * @brief Destructor
+    */
+   ~StateResampler() = default;
+
+   /**
+    * @brief Set boundary condition rows at output resolution
+    *
+    * Only the nonzero rows of the tau operators are used
+    *
+    * @param tau  Tau operators holding the boundary rows
+    */
+   void setBoundary(const std::vector<SparseMatrix>& tau);
+
+   /**
+    * @brief Resample Chebyshev expansion
+    *
+    * @param out  Output expansion
+    * @param in   Input expansion
+    */
+   void resample(Eigen::Ref<ArrayZ> out,
+      const Eigen::Ref<const ArrayZ>& in) const;
+
+   /**
+    * @brief Signed wave number of Fourier index
+    *
+    * Negative wave numbers are stored after the positive ones
+    *
+    * @param idx  Index
+    * @param n    Number of stored modes
+    */
+   static int waveNumber(const int idx, const int n);
+
+   /**
+    * @brief Map Fourier index from one resolution to the other
+    *
+    * @param idx     Index at output resolution
+    * @param nIn     Number of stored modes at input resolution
+    * @param nOut    Number of stored modes at output resolution
+    * @param hasNeg  Negative wave numbers are stored?
+    *
+    * @return Index at input resolution or -1 if mode is not available
+    */
+   static int mapIndex(const int idx, const int nIn, const int nOut,
+      const bool hasNeg);
+
+protected:
+private:
+   /**
+    * @brief Size of input expansion
+    */
+   int mNIn;
+
+   /**
+    * @brief Size of output expansion
+    */
+   int mNOut;
+
+   /**
+    * @brief Boundary condition rows
+    */
+   Matrix mBc;
+
+   /**
+    * @brief LU factorization of boundary rows restricted to last coefficients
+    */
+   Eigen::FullPivLU<Matrix> mTailLu;
+};
+
+} // namespace RBC
+} // namespace Plane
+} // namespace Boussinesq
+} // namespace Model
+} // namespace QuICC
+
+#endif // QUICC_MODEL_BOUSSINESQ_PLANE_RBC_STATERESAMPLER_HPP
@@ -0,0 +1,65 @@
+"""Module provides the functions to generate the Boussinesq Rayleigh-Benard convection in a plane layer (2 periodic directions) (Toroidal/Poloidal formulation) with explicit buoyancy"""
+
+from __future__ import division
+from __future__ import unicode_literals
+
+import quicc.geometry.cartesian.cartesian_1d as geo
+
+from ..explicit import physical_model as explicit
+
+
+class PhysicalModelConfig(explicit.PhysicalModelConfig):
+    """Class to setup the Boussinesq Rayleigh-Benard convection in a plane layer (2 periodic directions) (Toroidal/Poloidal formulation) with explicit buoyancy"""
+
+    pass
+
+class PhysicalModel(explicit.PhysicalModel):
+    """Class to setup the Boussinesq Rayleigh-Benard convection in a plane layer (2 periodic directions) (Toroidal/poloidal formulation) with explicit buoyancy"""
+
+    def implicit_fields(self, field_row):
+        """Get the list of coupled fields in solve"""
+
+        # Buoyancy is explicit: all fields are solved independently
+        fields =  [field_row]
+
+        return fields
+
+    def explicit_fields(self, timing, field_row):
+        """Get the list of fields with explicit dependence"""
+
+        # Explicit linear terms
+        if timing == self.EXPLICIT_LINEAR:
+            if field_row in [("velocity","pol")]:
+                fields = [("temperature","")]
+            else:
+                fields = []
+
+        else:
+            fields = super().explicit_fields(timing, field_row)
+
+        return fields
+
+    def explicit_block(self, res, eq_params, eigs, bcs, field_row, field_col, restriction = None):
+        """Create matrix block for explicit linear term"""
+
+        Ra = eq_params['rayleigh']
+        Pr = eq_params['prandtl']
+        zi, zo = (self.automatic_parameters(eq_params)['lower1d'], self.automatic_parameters(eq_params)['upper1d'])
+        kx = eigs[0]
+        ky = eigs[1]
+
+        mat = None
+        bc = self.convert_bc(eq_params,eigs,bcs,field_row,field_col)
+        # Buoyancy
+        if field_row == ("velocity","pol") and field_col == ("temperature",""):
+            mat = geo.i4(res[0], zi, zo, bc, (kx**2 + ky**2)*(Ra/Pr))
+
+        if mat is None:
+            raise RuntimeError("Equations are not setup properly!")
+
+        return mat
+
+class PhysicalModelVisu(explicit.PhysicalModelVisu):
+    """Class to setup the visualization options for TFF scheme """
+
+    pass
@@ -0,0 +1,153 @@
+/**
+ * @file AssemblyBenchmark.cpp
+ * @brief Per-mode assembly of the poloidal operators from the quasi-inverse
+ * operators against the weighted sum of their k-independent components
+ *
+ * For each resolution the implicit operator laplh I4 Lapl2 and the time
+ * operator laplh I4 Lapl of the poloidal equation are assembled for a range
+ * of wave numbers, once by building the quasi-inverse operators of every
+ * mode as in the Explicit backend and once from the components of the
+ * powers of k^2. The assembly time per mode and the largest relative
+ * difference are reported.
+ *
+ * The benchmark fails if the difference exceeds its tolerance or if the
+ * time operator of the mean mode, which vanishes with k^2, keeps entries.
+ *
+ * usage: AssemblyBenchmark [N ...]
+ */
+
+// System includes
+//
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Project includes
+//
+#include "Model/Boussinesq/Plane/RBC/AffineOperator.hpp"
+#include "QuICC/SparseSM/Chebyshev/LinearMap/I4.hpp"
+#include "QuICC/SparseSM/Chebyshev/LinearMap/I4Lapl.hpp"
+#include "QuICC/SparseSM/Chebyshev/LinearMap/I4Lapl2.hpp"
+#include "Types/Typedefs.hpp"
+
+namespace LinearMap = QuICC::SparseSM::Chebyshev::LinearMap;
+using QuICC::MHDFloat;
+using QuICC::SparseMatrix;
+using QuICC::Model::Boussinesq::Plane::RBC::AffineOperator;
+
+namespace {
+
+/// Lower boundary
+const MHDFloat zi = -1.0;
+/// Upper boundary
+const MHDFloat zo = 1.0;
+/// Number of modes
+const int nModes = 1000;
+/// Spacing of the wave numbers
+const MHDFloat dk = 0.1;
+/// Tolerance on the relative difference of the assembled operators
+const MHDFloat tol = 1e-10;
+
+/**
+ * @brief Report failed check, return 1 if failed
+ *
+ * @param ok   Check passed?
+ * @param msg  Description of the check
+ */
+int report(const bool ok, const std::string& msg)
+{
+   if (!ok)
+   {
+      std::cerr << msg << std::endl;
+   }
+
+   return !ok;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+   std::vector<int> sizes;
+   for (int i = 1; i < argc; ++i)
+   {
+      sizes.push_back(std::atoi(argv[i]));
+   }
+   if (sizes.empty())
+   {
+      sizes = {32, 64, 128, 256};
+   }
+
+   std::cout << "# poloidal operators of " << nModes << " modes, k <= "
+             << nModes * dk << std::endl;
+   std::cout << "#" << std::setw(5) << "N" << std::setw(13) << "direct [s]"
+             << std::setw(13) << "affine [s]" << std::setw(10) << "speedup"
+             << std::setw(13) << "max error" << std::endl;
+
+   int failures = 0;
+   for (auto nN: sizes)
+   {
+      const std::string tag = "N = " + std::to_string(nN) + ": ";
+
+      // k-independent components, built once
+      LinearMap::I4 i4(nN, nN, zi, zo);
+      LinearMap::I4Lapl i4d2(nN, nN, zi, zo, 0.0, 0.0);
+      LinearMap::I4Lapl2 i4d4(nN, nN, zi, zo, 0.0, 0.0);
+      AffineOperator implicitOp({SparseMatrix(nN, nN), -i4d4.mat(),
+         2.0 * i4d2.mat(), -i4.mat()});
+      AffineOperator timeOp({SparseMatrix(nN, nN), -i4d2.mat(), i4.mat()});
+
+      std::vector<SparseMatrix> L(nModes), T(nModes);
+      auto start = std::chrono::steady_clock::now();
+      for (int m = 0; m < nModes; ++m)
+      {
+         const MHDFloat k1 = (m + 1) * dk;
+         const auto laplh = -k1 * k1;
+         L.at(m) = laplh * LinearMap::I4Lapl2(nN, nN, zi, zo, k1, 0.0).mat();
+         T.at(m) = laplh * LinearMap::I4Lapl(nN, nN, zi, zo, k1, 0.0).mat();
+      }
+      auto stop = std::chrono::steady_clock::now();
+      std::chrono::duration<double> directTime = stop - start;
+
+      std::vector<SparseMatrix> La(nModes), Ta(nModes);
+      start = std::chrono::steady_clock::now();
+      for (int m = 0; m < nModes; ++m)
+      {
+         const MHDFloat k1 = (m + 1) * dk;
+         La.at(m) = implicitOp.mat(k1 * k1);
+         Ta.at(m) = timeOp.mat(k1 * k1);
+      }
+      stop = std::chrono::steady_clock::now();
+      std::chrono::duration<double> affineTime = stop - start;
+
+      MHDFloat err = 0.0;
+      for (int m = 0; m < nModes; ++m)
+      {
+         err = std::max(err, (La.at(m) - L.at(m)).norm() / L.at(m).norm());
+         err = std::max(err, (Ta.at(m) - T.at(m)).norm() / T.at(m).norm());
+      }
+
+      std::cout << std::setw(6) << nN << std::setw(13) << directTime.count()
+                << std::setw(13) << affineTime.count() << std::setw(10)
+                << std::setprecision(3)
+                << directTime.count() / affineTime.count() << std::setw(13)
+                << err << std::endl;
+
+      failures += report(err <= tol, tag + "difference exceeds tolerance");
+      failures += report(timeOp.mat(0.0).nonZeros() == 0,
+         tag + "mean mode operator keeps zero entries");
+   }
+
+   if (failures > 0)
+   {
+      std::cerr << failures << " failures" << std::endl;
+      return 1;
+   }
+
+   std::cout << "assembly benchmark: passed" << std::endl;
+   return 0;
+}
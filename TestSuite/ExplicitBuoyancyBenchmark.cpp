@@ -0,0 +1,341 @@
+/**
+ * @file ExplicitBuoyancyBenchmark.cpp
+ * @brief Stability, accuracy and cost of the explicit buoyancy of the
+ * ExplicitBuoyancy model compared to the Explicit model
+ *
+ * The linear poloidal/temperature system of a mode is given by
+ * LinearStability. Both models treat the advection of the conduction profile
+ * explicitly, the Explicit model solves the buoyancy implicitly in a coupled
+ * 2N system, the ExplicitBuoyancy model moves it to the explicit side and
+ * solves two independent N systems.
+ *
+ * For each resolution and model the first order IMEX step
+ *
+ *    \f$ (B - \Delta t L_{im}) x^{n+1} = (B + \Delta t L_{ex}) x^n \f$
+ *
+ * is analyzed: sparse LU fill-in, factorization and solve times, the relative
+ * error of the growth rate given by the spectral radius of the step compared
+ * to the eigenvalue problem \f$ L x = \sigma B x \f$ at a timestep of 1% of
+ * the buoyancy time scale sqrt(Pr/Ra) and the largest timestep keeping this
+ * error below 1%. An unstable step of a
+ * decaying mode has an error above 100%, the largest timestep therefore also
+ * bounds the stable timestep.
+ *
+ * The benchmark fails if a factorization fails, if the growth rate error at
+ * the fixed timestep exceeds its tolerance, if the split systems fill in more
+ * than the coupled system or if the largest timestep of the explicit buoyancy
+ * is not bounded by the buoyancy time scale.
+ *
+ * usage: ExplicitBuoyancyBenchmark Ra Pr [N ...]
+ */
+
+// System includes
+//
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+#include <Eigen/Eigenvalues>
+#include <Eigen/SparseLU>
+
+// Project includes
+//
+#include "Model/Boussinesq/Plane/RBC/LinearStability.hpp"
+#include "QuICC/Bc/Name/FixedTemperature.hpp"
+#include "QuICC/Bc/Name/NoSlip.hpp"
+#include "Types/Typedefs.hpp"
+
+using QuICC::ArrayZ;
+using QuICC::Matrix;
+using QuICC::MHDFloat;
+using QuICC::SparseMatrix;
+using QuICC::Model::Boussinesq::Plane::RBC::LinearStability;
+
+namespace {
+
+/// Lower boundary
+const MHDFloat zi = 0.0;
+/// Upper boundary
+const MHDFloat zo = 1.0;
+/// Critical wave number of the no-slip onset
+const MHDFloat k1 = 3.117;
+/// Second wave number
+const MHDFloat k2 = 0.0;
+/// Timestep of the accuracy measurement in units of sqrt(Pr/Ra)
+const MHDFloat dtScale = 1e-2;
+/// Tolerance on the relative growth rate error of the largest timestep
+const MHDFloat growthTol = 1e-2;
+/// Tolerance on the relative growth rate error at the fixed timestep
+const MHDFloat dtTol = 1e-2;
+/// Lower bound of the largest timestep of the explicit buoyancy in units of
+/// sqrt(Pr/Ra)
+const MHDFloat minScale = 5e-3;
+/// Upper bound of the largest timestep of the explicit buoyancy in units of
+/// sqrt(Pr/Ra)
+const MHDFloat maxScale = 5e-1;
+/// Number of repeated solves for timing
+const int nSolve = 100;
+
+/**
+ * @brief Spectral radius of the IMEX step
+ *
+ * @param B       Time operator
+ * @param Lim     Implicit operator
+ * @param Lex     Explicit operator
+ * @param step    Timestep
+ */
+MHDFloat stepRadius(const Matrix& B, const Matrix& Lim, const Matrix& Lex,
+   const MHDFloat step)
+{
+   Matrix A = Matrix(B - step * Lim).partialPivLu().solve(B + step * Lex);
+   Eigen::EigenSolver<Matrix> solver(A, false);
+
+   return solver.eigenvalues().cwiseAbs().maxCoeff();
+}
+
+/**
+ * @brief Relative error of the growth rate of the IMEX step
+ *
+ * @param B       Time operator
+ * @param Lim     Implicit operator
+ * @param Lex     Explicit operator
+ * @param growth  Exact fastest growth rate
+ * @param step    Timestep
+ */
+MHDFloat growthError(const Matrix& B, const Matrix& Lim, const Matrix& Lex,
+   const MHDFloat growth, const MHDFloat step)
+{
+   const auto numGrowth = std::log(stepRadius(B, Lim, Lex, step)) / step;
+
+   return std::abs(numGrowth - growth) / std::abs(growth);
+}
+
+/**
+ * @brief Largest timestep with a growth rate error below growthTol
+ *
+ * @param B       Time operator
+ * @param Lim     Implicit operator
+ * @param Lex     Explicit operator
+ * @param growth  Exact fastest growth rate
+ */
+MHDFloat maxStep(const Matrix& B, const Matrix& Lim, const Matrix& Lex,
+   const MHDFloat growth)
+{
+   auto isAccurate = [&](const MHDFloat step)
+   { return growthError(B, Lim, Lex, growth, step) <= growthTol; };
+
+   // Bracket first failure, then bisect in log space
+   MHDFloat lo = 1e-8;
+   MHDFloat hi = lo;
+   while (isAccurate(hi))
+   {
+      lo = hi;
+      hi *= 2.0;
+      if (hi > 1e2)
+      {
+         return std::numeric_limits<MHDFloat>::infinity();
+      }
+   }
+   for (int i = 0; i < 30; ++i)
+   {
+      const auto mid = std::sqrt(lo * hi);
+      if (isAccurate(mid))
+      {
+         lo = mid;
+      }
+      else
+      {
+         hi = mid;
+      }
+   }
+
+   return lo;
+}
+
+/**
+ * @brief Factorize and time the implicit systems
+ *
+ * @param nnzLU      Output number of nonzeros of the LU factors
+ * @param factorTime Output factorization time
+ * @param solveTime  Output time of a single solve
+ * @param systems    Implicit systems B - dt L_im
+ */
+bool timeSolves(std::size_t& nnzLU, double& factorTime, double& solveTime,
+   const std::vector<SparseMatrix>& systems)
+{
+   nnzLU = 0;
+   factorTime = 0.0;
+   solveTime = 0.0;
+   for (auto A: systems)
+   {
+      A.makeCompressed();
+      Eigen::SparseLU<SparseMatrix> lu;
+      auto start = std::chrono::steady_clock::now();
+      lu.analyzePattern(A);
+      lu.factorize(A);
+      auto stop = std::chrono::steady_clock::now();
+      if (lu.info() != Eigen::Success)
+      {
+         return false;
+      }
+      factorTime += std::chrono::duration<double>(stop - start).count();
+      nnzLU += lu.nnzL() + lu.nnzU();
+
+      QuICC::Array rhs = QuICC::Array::Ones(A.rows());
+      QuICC::Array sol;
+      start = std::chrono::steady_clock::now();
+      for (int i = 0; i < nSolve; ++i)
+      {
+         sol = lu.solve(rhs);
+      }
+      stop = std::chrono::steady_clock::now();
+      solveTime +=
+         std::chrono::duration<double>(stop - start).count() / nSolve;
+   }
+
+   return true;
+}
+
+/**
+ * @brief Report failed check, return 1 if failed
+ *
+ * @param ok   Check passed?
+ * @param msg  Description of the check
+ */
+int report(const bool ok, const std::string& msg)
+{
+   if (!ok)
+   {
+      std::cerr << msg << std::endl;
+   }
+
+   return !ok;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+   if (argc < 3)
+   {
+      std::cerr << "usage: ExplicitBuoyancyBenchmark Ra Pr [N ...]"
+                << std::endl;
+      return 1;
+   }
+   const MHDFloat Ra = std::atof(argv[1]);
+   const MHDFloat Pr = std::atof(argv[2]);
+   const MHDFloat buoyancyScale = std::sqrt(Pr / Ra);
+   const MHDFloat dt = dtScale * buoyancyScale;
+
+   std::vector<int> sizes;
+   for (int i = 3; i < argc; ++i)
+   {
+      sizes.push_back(std::atoi(argv[i]));
+   }
+   if (sizes.empty())
+   {
+      sizes = {32, 64, 128};
+   }
+
+   std::cout << "# no-slip, fixed temperature, k = " << k1 << ", Ra = " << Ra
+             << ", Pr = " << Pr << ", dt = " << dt
+             << ", sqrt(Pr/Ra) = " << buoyancyScale
+             << ", max dt at growth err " << growthTol << std::endl;
+   std::cout << "#" << std::setw(5) << "N" << std::setw(18) << "model"
+             << std::setw(10) << "nnz(LU)" << std::setw(13) << "factor [s]"
+             << std::setw(13) << "solve [s]" << std::setw(13) << "growth err"
+             << std::setw(13) << "max dt" << std::endl;
+
+   int failures = 0;
+   for (auto nN: sizes)
+   {
+      const std::string tag = "N = " + std::to_string(nN) + ": ";
+      LinearStability stability(nN, zi, zo, Ra, Pr,
+         QuICC::Bc::Name::NoSlip::id(),
+         QuICC::Bc::Name::FixedTemperature::id());
+      ArrayZ pol, temp;
+      const auto growth = stability.fastest(pol, temp, k1, k2).real();
+
+      SparseMatrix spB, diffusion, buoyancy, advection;
+      stability.operators(spB, diffusion, buoyancy, advection, k1, k2);
+      const Matrix B(spB);
+
+      struct Variant
+      {
+         const char* name;
+         bool isCoupled;
+         SparseMatrix implicit;
+         SparseMatrix explicit_;
+      };
+      const std::vector<Variant> variants = {
+         {"Explicit", true, diffusion + buoyancy, advection},
+         {"ExplicitBuoyancy", false, diffusion, buoyancy + advection}};
+
+      std::vector<std::size_t> fillIn;
+      for (const auto& v: variants)
+      {
+         SparseMatrix A = spB - dt * v.implicit;
+         std::vector<SparseMatrix> systems;
+         if (v.isCoupled)
+         {
+            systems.push_back(A);
+         }
+         else
+         {
+            systems.push_back(A.topLeftCorner(nN, nN));
+            systems.push_back(A.bottomRightCorner(nN, nN));
+         }
+
+         std::size_t nnzLU;
+         double factorTime;
+         double solveTime;
+         if (!timeSolves(nnzLU, factorTime, solveTime, systems))
+         {
+            std::cerr << tag << v.name << " factorization failed" << std::endl;
+            ++failures;
+            continue;
+         }
+         fillIn.push_back(nnzLU);
+
+         const Matrix Lim(v.implicit);
+         const Matrix Lex(v.explicit_);
+         const auto step = maxStep(B, Lim, Lex, growth);
+         const auto err = growthError(B, Lim, Lex, growth, dt);
+
+         std::cout << std::setw(6) << nN << std::setw(18) << v.name
+                   << std::setw(10) << nnzLU << std::setw(13)
+                   << std::scientific << std::setprecision(3) << factorTime
+                   << std::setw(13) << solveTime << std::setw(13) << err
+                   << std::setw(13) << step << std::defaultfloat << std::endl;
+
+         failures += report(err <= dtTol,
+            tag + v.name + " growth rate error exceeds tolerance");
+         if (!v.isCoupled)
+         {
+            failures += report(step >= minScale * buoyancyScale &&
+                                  step <= maxScale * buoyancyScale,
+               tag + v.name + " largest timestep is not bounded by the " +
+                  "buoyancy time scale");
+         }
+      }
+
+      if (fillIn.size() == variants.size())
+      {
+         failures += report(fillIn.back() <= fillIn.front(),
+            tag + "split systems fill in more than the coupled system");
+      }
+   }
+
+   if (failures > 0)
+   {
+      std::cerr << failures << " failures" << std::endl;
+      return 1;
+   }
+
+   std::cout << "explicit buoyancy benchmark: passed" << std::endl;
+   return 0;
+}
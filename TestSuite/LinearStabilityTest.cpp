@@ -0,0 +1,148 @@
+/**
+ * @file LinearStabilityTest.cpp
+ * @brief Onset of convection of the linear stability problem
+ *
+ * The critical Rayleigh number is bracketed by bisection on the growth rate
+ * of the fastest eigenmode at the critical wave number of the layer [0, 1].
+ * With no-slip walls it has to match Ra_c = 1707.76 at k_c = 3.117, with
+ * stress-free walls Ra_c = 27 pi^4 / 4 at k_c = pi / sqrt(2). The wave
+ * number is split over both horizontal directions for the stress-free case.
+ * The fastest eigenmode has to be normalized to a unit maximum temperature
+ * coefficient.
+ *
+ * usage: LinearStabilityTest
+ */
+
+// System includes
+//
+#include <cmath>
+#include <iostream>
+#include <string>
+
+// Project includes
+//
+#include "Model/Boussinesq/Plane/RBC/LinearStability.hpp"
+#include "QuICC/Bc/Name/FixedTemperature.hpp"
+#include "QuICC/Bc/Name/NoSlip.hpp"
+#include "QuICC/Bc/Name/StressFree.hpp"
+#include "QuICC/Math/Constants.hpp"
+#include "Types/Typedefs.hpp"
+
+using QuICC::ArrayZ;
+using QuICC::MHDFloat;
+using QuICC::Model::Boussinesq::Plane::RBC::LinearStability;
+
+namespace {
+
+/// Size of the Chebyshev expansion
+const int nN = 32;
+/// Prandtl number
+const MHDFloat Pr = 1.0;
+/// Relative tolerance on the critical Rayleigh number
+const MHDFloat tol = 1e-4;
+
+/**
+ * @brief Growth rate of the fastest eigenmode
+ *
+ * @param Ra      Rayleigh number
+ * @param velBcId Boundary condition ID of velocity
+ * @param k1      First wave number
+ * @param k2      Second wave number
+ */
+MHDFloat growthRate(const MHDFloat Ra, const std::size_t velBcId,
+   const MHDFloat k1, const MHDFloat k2)
+{
+   LinearStability stability(nN, 0.0, 1.0, Ra, Pr, velBcId,
+      QuICC::Bc::Name::FixedTemperature::id());
+   ArrayZ pol, temp;
+   return stability.fastest(pol, temp, k1, k2).real();
+}
+
+/**
+ * @brief Check critical Rayleigh number, return number of failures
+ *
+ * @param name    Name of the case
+ * @param velBcId Boundary condition ID of velocity
+ * @param k1      First wave number
+ * @param k2      Second wave number
+ * @param RaC     Expected critical Rayleigh number
+ */
+int checkOnset(const std::string& name, const std::size_t velBcId,
+   const MHDFloat k1, const MHDFloat k2, const MHDFloat RaC)
+{
+   MHDFloat lo = 0.9 * RaC;
+   MHDFloat hi = 1.1 * RaC;
+   if (growthRate(lo, velBcId, k1, k2) >= 0 ||
+       growthRate(hi, velBcId, k1, k2) <= 0)
+   {
+      std::cerr << name << ": onset is not bracketed" << std::endl;
+      return 1;
+   }
+
+   while (hi - lo > 0.1 * tol * RaC)
+   {
+      const MHDFloat mid = 0.5 * (lo + hi);
+      if (growthRate(mid, velBcId, k1, k2) < 0)
+      {
+         lo = mid;
+      }
+      else
+      {
+         hi = mid;
+      }
+   }
+
+   const MHDFloat Ra = 0.5 * (lo + hi);
+   if (std::abs(Ra - RaC) > tol * RaC)
+   {
+      std::cerr << name << ": Ra_c = " << Ra << ", expected " << RaC
+                << std::endl;
+      return 1;
+   }
+
+   return 0;
+}
+
+/**
+ * @brief Check normalization of the fastest mode, return number of failures
+ */
+int checkNormalization()
+{
+   LinearStability stability(nN, 0.0, 1.0, 2000.0, Pr,
+      QuICC::Bc::Name::NoSlip::id(), QuICC::Bc::Name::FixedTemperature::id());
+   ArrayZ pol, temp;
+   stability.fastest(pol, temp, 3.117, 0.0);
+
+   if (pol.size() != nN || temp.size() != nN ||
+       std::abs(temp.cwiseAbs().maxCoeff() - 1.0) > 1e-12)
+   {
+      std::cerr << "fastest mode is not normalized" << std::endl;
+      return 1;
+   }
+
+   return 0;
+}
+
+} // namespace
+
+int main()
+{
+   const MHDFloat pi = QuICC::Math::PI;
+   const MHDFloat kSf = pi / std::sqrt(2.0);
+
+   int failures = 0;
+   failures += checkOnset("no-slip", QuICC::Bc::Name::NoSlip::id(), 3.117,
+      0.0, 1707.76);
+   failures += checkOnset("stress-free", QuICC::Bc::Name::StressFree::id(),
+      kSf / std::sqrt(2.0), kSf / std::sqrt(2.0), 27.0 * std::pow(pi, 4) / 4.0);
+   failures += checkNormalization();
+
+   if (failures > 0)
+   {
+      std::cerr << failures << " failures" << std::endl;
+      return 1;
+   }
+
+   std::cout << "linear stability: passed" << std::endl;
+   return 0;
+}
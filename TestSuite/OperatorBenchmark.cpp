@@ -0,0 +1,275 @@
+/**
+ * @file OperatorBenchmark.cpp
+ * @brief Cost and accuracy of dropping the last quasi-inverse columns of the
+ * poloidal operator
+ *
+ * For each resolution, with and without the McFadden-Murray-Boisvert column
+ * drop (operators/drop_qi_columns), the timestep operator of the
+ * no-slip poloidal equation is built as in the Explicit backend and the
+ * bandwidth, the sparse LU fill-in and the factorization and solve times are
+ * reported. Accuracy is measured on the Stokes eigenvalue problem of the same
+ * operators: number of spurious unstable tau eigenvalues and the relative
+ * error of the slowest decay rate compared to a twice finer resolution.
+ *
+ * The benchmark fails if a factorization fails, if the decay rate error
+ * exceeds its tolerance or if the column drop leaves spurious unstable
+ * eigenvalues.
+ *
+ * usage: OperatorBenchmark [N ...]
+ */
+
+// System includes
+//
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+#include <Eigen/Eigenvalues>
+#include <Eigen/SparseLU>
+
+// Project includes
+//
+#include "Model/Boussinesq/Plane/RBC/IRBCBackend.hpp"
+#include "QuICC/Bc/Name/NoSlip.hpp"
+#include "QuICC/Enums/FieldIds.hpp"
+#include "QuICC/PhysicalNames/Velocity.hpp"
+#include "QuICC/SparseSM/Chebyshev/LinearMap/I4Lapl.hpp"
+#include "QuICC/SparseSM/Chebyshev/LinearMap/I4Lapl2.hpp"
+#include "QuICC/SparseSM/Chebyshev/LinearMap/Id.hpp"
+#include "Types/Typedefs.hpp"
+
+namespace LinearMap = QuICC::SparseSM::Chebyshev::LinearMap;
+using QuICC::Matrix;
+using QuICC::MHDComplex;
+using QuICC::MHDFloat;
+using QuICC::SparseMatrix;
+using QuICC::Model::Boussinesq::Plane::RBC::IRBCBackend;
+
+namespace {
+
+/// Lower boundary
+const MHDFloat zi = 0.0;
+/// Upper boundary
+const MHDFloat zo = 1.0;
+/// Critical wave number of the no-slip onset
+const MHDFloat k1 = 3.117;
+/// Second wave number
+const MHDFloat k2 = 0.0;
+/// Timestep used in the timestep operator
+const MHDFloat dt = 1e-4;
+/// Tolerance on the relative error of the slowest decay rate
+const MHDFloat decayTol = 1e-8;
+/// Number of repeated solves for timing
+const int nSolve = 100;
+
+/**
+ * @brief Build implicit and time operators of the poloidal equation
+ *
+ * @param L          Implicit operator with tau lines
+ * @param B          Time operator
+ * @param nN         Size of Chebyshev expansion
+ * @param dropQIColumns Drop the last two columns of the time operator?
+ */
+void buildOperators(SparseMatrix& L, SparseMatrix& B, const int nN,
+   const bool dropQIColumns)
+{
+   const auto laplh = -(k1 * k1 + k2 * k2);
+   auto velPol = std::make_pair(QuICC::PhysicalNames::Velocity::id(),
+      QuICC::FieldComponents::Spectral::POL);
+
+   L = laplh * LinearMap::I4Lapl2(nN, nN, zi, zo, k1, k2).mat();
+   L += IRBCBackend::tauOperator(velPol, nN, zi, zo,
+      QuICC::Bc::Name::NoSlip::id(), false, false, false);
+
+   B = laplh * LinearMap::I4Lapl(nN, nN, zi, zo, k1, k2).mat();
+   if (dropQIColumns)
+   {
+      LinearMap::Id qid(nN, nN, zi, zo, -2);
+      B = B * qid.mat();
+   }
+}
+
+/**
+ * @brief Bandwidth of operator without the tau lines
+ *
+ * @param mat  Operator
+ * @param nBc  Number of tau lines
+ */
+int bandwidth(const SparseMatrix& mat, const int nBc)
+{
+   int band = 0;
+   for (int j = 0; j < mat.outerSize(); ++j)
+   {
+      for (SparseMatrix::InnerIterator it(mat, j); it; ++it)
+      {
+         if (it.row() >= nBc && it.value() != 0.0)
+         {
+            band = std::max(band, static_cast<int>(std::abs(it.row() - j)));
+         }
+      }
+   }
+
+   return band;
+}
+
+/**
+ * @brief Stokes eigenvalues sigma of L x = sigma B x
+ *
+ * @param nSpurious  Number of unstable spurious eigenvalues
+ * @param L          Implicit operator with tau lines
+ * @param B          Time operator
+ *
+ * @return Slowest decay rate
+ */
+MHDFloat slowestDecay(int& nSpurious, const SparseMatrix& L,
+   const SparseMatrix& B)
+{
+   // Shift-invert, infinite eigenvalues of the tau formulation map to 0
+   const MHDFloat shift = -1.0;
+   Matrix A = Matrix(L - shift * B).partialPivLu().solve(Matrix(B));
+   Eigen::EigenSolver<Matrix> solver(A, false);
+   const auto& mu = solver.eigenvalues();
+   const MHDFloat tol = 1e3 * std::numeric_limits<MHDFloat>::epsilon() *
+                        mu.cwiseAbs().maxCoeff();
+
+   nSpurious = 0;
+   MHDFloat slowest = -std::numeric_limits<MHDFloat>::max();
+   for (int i = 0; i < mu.size(); ++i)
+   {
+      if (std::abs(mu(i)) > tol)
+      {
+         MHDComplex s = shift + 1.0 / mu(i);
+         if (s.real() > 0)
+         {
+            ++nSpurious;
+         }
+         else
+         {
+            slowest = std::max(slowest, s.real());
+         }
+      }
+   }
+
+   return slowest;
+}
+
+/**
+ * @brief Report failed check, return 1 if failed
+ *
+ * @param ok   Check passed?
+ * @param msg  Description of the check
+ */
+int report(const bool ok, const std::string& msg)
+{
+   if (!ok)
+   {
+      std::cerr << msg << std::endl;
+   }
+
+   return !ok;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+   std::vector<int> sizes;
+   for (int i = 1; i < argc; ++i)
+   {
+      sizes.push_back(std::atoi(argv[i]));
+   }
+   if (sizes.empty())
+   {
+      sizes = {32, 64, 128, 256};
+   }
+
+   const int nBc = 4;
+   std::cout << "# poloidal no-slip operator, k = " << k1 << ", dt = " << dt
+             << std::endl;
+   std::cout << "#" << std::setw(5) << "N" << std::setw(6) << "drop"
+             << std::setw(6) << "band" << std::setw(9) << "nnz(A)"
+             << std::setw(10) << "nnz(LU)" << std::setw(8) << "fill"
+             << std::setw(13) << "factor [s]" << std::setw(13) << "solve [s]"
+             << std::setw(10) << "spurious" << std::setw(13) << "decay err"
+             << std::endl;
+
+   int failures = 0;
+   for (auto nN: sizes)
+   {
+      // Reference decay rate from twice finer resolution
+      SparseMatrix L, B;
+      buildOperators(L, B, 2 * nN, false);
+      int nRefSpurious;
+      const auto ref = slowestDecay(nRefSpurious, L, B);
+
+      for (auto dropQIColumns: {false, true})
+      {
+         const std::string tag = "N = " + std::to_string(nN) +
+                                 ", drop = " + std::to_string(dropQIColumns) +
+                                 ": ";
+         buildOperators(L, B, nN, dropQIColumns);
+         SparseMatrix A = B - dt * L;
+         A.makeCompressed();
+
+         Eigen::SparseLU<SparseMatrix> lu;
+         auto start = std::chrono::steady_clock::now();
+         lu.analyzePattern(A);
+         lu.factorize(A);
+         auto stop = std::chrono::steady_clock::now();
+         std::chrono::duration<double> factorTime = stop - start;
+         if (lu.info() != Eigen::Success)
+         {
+            std::cerr << tag << "factorization failed" << std::endl;
+            ++failures;
+            continue;
+         }
+
+         QuICC::Array rhs = QuICC::Array::Ones(nN);
+         QuICC::Array sol;
+         start = std::chrono::steady_clock::now();
+         for (int i = 0; i < nSolve; ++i)
+         {
+            sol = lu.solve(rhs);
+         }
+         stop = std::chrono::steady_clock::now();
+         std::chrono::duration<double> solveTime = stop - start;
+
+         int nSpurious;
+         const auto decay = slowestDecay(nSpurious, L, B);
+
+         const auto err = std::abs(decay - ref) / std::abs(ref);
+         const auto nnzLU = lu.nnzL() + lu.nnzU();
+         std::cout << std::setw(6) << nN << std::setw(6) << dropQIColumns
+                   << std::setw(6) << bandwidth(A, nBc) << std::setw(9)
+                   << A.nonZeros() << std::setw(10) << nnzLU << std::setw(8)
+                   << std::setprecision(3)
+                   << static_cast<double>(nnzLU) / A.nonZeros()
+                   << std::setw(13) << std::scientific << factorTime.count()
+                   << std::setw(13) << solveTime.count() / nSolve
+                   << std::setw(10) << nSpurious << std::setw(13) << err
+                   << std::defaultfloat << std::endl;
+
+         failures +=
+            report(err <= decayTol, tag + "decay rate error exceeds tolerance");
+         if (dropQIColumns)
+         {
+            failures += report(nSpurious == 0,
+               tag + "spurious unstable eigenvalues remain");
+         }
+      }
+   }
+
+   if (failures > 0)
+   {
+      std::cerr << failures << " failures" << std::endl;
+      return 1;
+   }
+
+   std::cout << "operator benchmark: passed" << std::endl;
+   return 0;
+}
@@ -0,0 +1,138 @@
+/**
+ * @file RandomSpectrumTest.cpp
+ * @brief Decomposition independence and Hermitian symmetry of the random
+ * spectrum
+ *
+ * The spectrum is generated once by a single kernel visiting every global
+ * index and once by three kernels that each own a round-robin share of the
+ * slow index and visit their middle indexes in reverse order, as different
+ * MPI decompositions would. Both spectra have to agree bit for bit. On the
+ * k = 0 plane the coefficients have to be Hermitian in the complex Fourier
+ * direction, with real zero and Nyquist wave numbers, for even and odd sizes.
+ *
+ * usage: RandomSpectrumTest
+ */
+
+// System includes
+//
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+// Project includes
+//
+#include "Model/Boussinesq/Plane/RBC/RandomSpectrumKernel.hpp"
+#include "Types/Typedefs.hpp"
+
+using QuICC::MHDComplex;
+using QuICC::Model::Boussinesq::Plane::RBC::RandomSpectrumKernel;
+
+namespace {
+
+/// Seed of the generator
+const std::uint64_t seed = 7;
+/// Stream of the generator
+const std::uint64_t stream = 2;
+/// Number of ranks of the distributed decomposition
+const int nRanks = 3;
+
+/**
+ * @brief Kernel initialized with the test seed
+ */
+RandomSpectrumKernel makeKernel()
+{
+   RandomSpectrumKernel kernel(true);
+   kernel.setRatio({10.0, 10.0, 10.0});
+   kernel.init(-1.0, 1.0, seed, stream);
+
+   return kernel;
+}
+
+/**
+ * @brief Check a spectrum of the given size, return number of failures
+ *
+ * @param nN   Size of the Chebyshev direction
+ * @param nJ   Size of the complex Fourier direction
+ * @param nK   Size of the real-to-complex Fourier direction
+ */
+int check(const int nN, const int nJ, const int nK)
+{
+   auto idx = [&](const int n, const int j, const int k)
+   { return (k * nJ + j) * nN + n; };
+
+   // Serial decomposition
+   std::vector<MHDComplex> serial(nN * nJ * nK);
+   auto kernel = makeKernel();
+   for (int k = 0; k < nK; ++k)
+   {
+      for (int j = 0; j < nJ; ++j)
+      {
+         for (int n = 0; n < nN; ++n)
+         {
+            serial.at(idx(n, j, k)) = kernel.coefficient(n, j, k, nN, nJ, nK);
+         }
+      }
+   }
+
+   // Distributed decomposition
+   std::vector<MHDComplex> distributed(nN * nJ * nK);
+   for (int r = 0; r < nRanks; ++r)
+   {
+      auto rankKernel = makeKernel();
+      for (int k = r; k < nK; k += nRanks)
+      {
+         for (int j = nJ - 1; j >= 0; --j)
+         {
+            for (int n = 0; n < nN; ++n)
+            {
+               distributed.at(idx(n, j, k)) =
+                  rankKernel.coefficient(n, j, k, nN, nJ, nK);
+            }
+         }
+      }
+   }
+
+   int failures = 0;
+   if (serial != distributed)
+   {
+      std::cerr << nN << "x" << nJ << "x" << nK
+                << ": spectrum depends on the decomposition" << std::endl;
+      ++failures;
+   }
+
+   // Hermitian symmetry of the k = 0 plane
+   for (int n = 0; n < nN; ++n)
+   {
+      for (int j = 0; j < nJ; ++j)
+      {
+         const int jc = (nJ - j) % nJ;
+         if (serial.at(idx(n, j, 0)) != std::conj(serial.at(idx(n, jc, 0))))
+         {
+            std::cerr << nN << "x" << nJ << "x" << nK << ": n = " << n
+                      << ", j = " << j << " is not Hermitian" << std::endl;
+            ++failures;
+         }
+      }
+   }
+
+   return failures;
+}
+
+} // namespace
+
+int main()
+{
+   int failures = 0;
+   failures += check(8, 12, 7);
+   failures += check(8, 11, 7);
+   failures += check(5, 2, 1);
+
+   if (failures > 0)
+   {
+      std::cerr << failures << " failures" << std::endl;
+      return 1;
+   }
+
+   std::cout << "random spectrum: passed" << std::endl;
+   return 0;
+}
@@ -0,0 +1,219 @@
+/**
+ * @file StateResamplerTest.cpp
+ * @brief Round trip and boundary conditions of the state resampler
+ *
+ * A Chebyshev expansion on [0, 1] satisfying the no-slip poloidal conditions
+ * (value and first derivative at both boundaries) is padded to a larger
+ * expansion and truncated back. The round trip has to reproduce the original
+ * expansion and every resampled expansion has to satisfy the boundary rows.
+ * Truncating a smooth expansion to a much smaller size has to restore the
+ * boundary conditions. The Fourier index map has to keep every stored wave
+ * number when padding and map back to the same index.
+ *
+ * usage: StateResamplerTest
+ */
+
+// System includes
+//
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Project includes
+//
+#include "Model/Boussinesq/Plane/RBC/StateResampler.hpp"
+#include "Types/Typedefs.hpp"
+
+using QuICC::ArrayZ;
+using QuICC::Matrix;
+using QuICC::MHDComplex;
+using QuICC::MHDFloat;
+using QuICC::SparseMatrix;
+using QuICC::Model::Boussinesq::Plane::RBC::StateResampler;
+
+namespace {
+
+/// Lower boundary
+const MHDFloat zi = 0.0;
+/// Upper boundary
+const MHDFloat zo = 1.0;
+/// Relative tolerance
+const MHDFloat tol = 1e-12;
+
+/**
+ * @brief Tau operator with value and first derivative rows at both boundaries
+ *
+ * @param nN   Size of the Chebyshev expansion
+ */
+std::vector<SparseMatrix> noSlipRows(const int nN)
+{
+   Matrix rows = Matrix::Zero(nN, nN);
+   const MHDFloat s = 2.0 / (zo - zi);
+   for (int n = 0; n < nN; ++n)
+   {
+      const MHDFloat sign = (n % 2 == 0) ? 1.0 : -1.0;
+      rows(0, n) = 1.0;
+      rows(1, n) = sign;
+      rows(2, n) = s * n * n;
+      rows(3, n) = -sign * s * n * n;
+   }
+
+   return {rows.sparseView()};
+}
+
+/**
+ * @brief Largest boundary residual relative to the expansion
+ *
+ * @param c    Chebyshev expansion
+ */
+MHDFloat residual(const ArrayZ& c)
+{
+   const Matrix bc = Matrix(noSlipRows(c.size()).front());
+   const MHDFloat rRe = (bc * c.real()).cwiseAbs().maxCoeff();
+   const MHDFloat rIm = (bc * c.imag()).cwiseAbs().maxCoeff();
+   return std::max(rRe, rIm) / (1.0 + c.cwiseAbs().maxCoeff());
+}
+
+/**
+ * @brief Smooth expansion satisfying the boundary conditions
+ *
+ * @param nN   Size of the Chebyshev expansion
+ */
+ArrayZ smoothExpansion(const int nN)
+{
+   ArrayZ c(nN);
+   for (int n = 0; n < nN; ++n)
+   {
+      c(n) = MHDComplex(std::cos(1.0 + n), std::sin(2.0 * n)) *
+             std::pow(0.7, n);
+   }
+
+   StateResampler project(nN, nN);
+   project.setBoundary(noSlipRows(nN));
+   ArrayZ out(nN);
+   project.resample(out, c);
+
+   return out;
+}
+
+/**
+ * @brief Report failed check, return 1 if failed
+ *
+ * @param ok   Check passed?
+ * @param msg  Description of the check
+ */
+int report(const bool ok, const std::string& msg)
+{
+   if (!ok)
+   {
+      std::cerr << msg << std::endl;
+   }
+
+   return !ok;
+}
+
+/**
+ * @brief Pad then truncate, return number of failures
+ *
+ * @param nIn  Size of the original expansion
+ * @param nPad Size of the padded expansion
+ */
+int checkRoundTrip(const int nIn, const int nPad)
+{
+   const ArrayZ c = smoothExpansion(nIn);
+   int failures = report(residual(c) < tol, "projected expansion violates bc");
+
+   StateResampler pad(nIn, nPad);
+   pad.setBoundary(noSlipRows(nPad));
+   ArrayZ padded(nPad);
+   pad.resample(padded, c);
+   failures += report(residual(padded) < tol, "padded expansion violates bc");
+   failures += report(
+      (padded.head(nIn) - c).cwiseAbs().maxCoeff() < tol * c.norm() &&
+         padded.tail(nPad - nIn).cwiseAbs().maxCoeff() < tol * c.norm(),
+      "padding changed the expansion");
+
+   StateResampler truncate(nPad, nIn);
+   truncate.setBoundary(noSlipRows(nIn));
+   ArrayZ back(nIn);
+   truncate.resample(back, padded);
+   failures += report(residual(back) < tol, "truncated expansion violates bc");
+   failures += report((back - c).cwiseAbs().maxCoeff() < tol * c.norm(),
+      "round trip changed the expansion");
+
+   return failures;
+}
+
+/**
+ * @brief Truncate a smooth expansion, return number of failures
+ *
+ * @param nIn  Size of the original expansion
+ * @param nOut Size of the truncated expansion
+ */
+int checkTruncation(const int nIn, const int nOut)
+{
+   const ArrayZ c = smoothExpansion(nIn);
+
+   StateResampler truncate(nIn, nOut);
+   truncate.setBoundary(noSlipRows(nOut));
+   ArrayZ out(nOut);
+   truncate.resample(out, c);
+
+   // Only the last coefficients are corrected
+   int failures = report(residual(out) < tol, "truncation violates bc");
+   failures += report(
+      (out.head(nOut - 4) - c.head(nOut - 4)).cwiseAbs().maxCoeff() == 0.0,
+      "truncation changed leading coefficients");
+
+   return failures;
+}
+
+/**
+ * @brief Map Fourier indexes up and back, return number of failures
+ *
+ * @param nIn  Number of stored modes at low resolution
+ * @param nOut Number of stored modes at high resolution
+ */
+int checkIndexMap(const int nIn, const int nOut)
+{
+   int failures = 0;
+   int nMapped = 0;
+   for (int idx = 0; idx < nOut; ++idx)
+   {
+      const int low = StateResampler::mapIndex(idx, nIn, nOut, true);
+      if (low >= 0)
+      {
+         ++nMapped;
+         failures += report(
+            StateResampler::mapIndex(low, nOut, nIn, true) == idx &&
+               StateResampler::waveNumber(low, nIn) ==
+                  StateResampler::waveNumber(idx, nOut),
+            "index " + std::to_string(idx) + " does not map back");
+      }
+   }
+   failures += report(nMapped == nIn, "padding dropped stored wave numbers");
+
+   return failures;
+}
+
+} // namespace
+
+int main()
+{
+   int failures = 0;
+   failures += checkRoundTrip(24, 40);
+   failures += checkRoundTrip(9, 10);
+   failures += checkTruncation(48, 16);
+   failures += checkIndexMap(7, 12);
+   failures += checkIndexMap(8, 12);
+
+   if (failures > 0)
+   {
+      std::cerr << failures << " failures" << std::endl;
+      return 1;
+   }
+
+   std::cout << "state resampler: passed" << std::endl;
+   return 0;
+}
@@ -0,0 +1,55 @@
+"""Validate an ExplicitBuoyancy benchmark run against the Explicit reference
+
+Both runs use the same physics and parameters, they only differ by the
+temporal treatment of the buoyancy. The reference archive of the
+ExplicitBuoyancy benchmark is therefore the one of the Explicit benchmark.
+The energy time series have to stay finite and within a relative deviation
+of the reference, the timestep has to stay positive.
+
+The per-mode stability, accuracy and solver cost are checked by the
+ExplicitBuoyancyBenchmark test.
+"""
+
+import sys
+import numpy as np
+import validation_tools as vt
+
+ref_dir, data_dir = vt.processArgv(sys.argv[1:])
+
+# Relative deviation of the energies allowed by the explicit buoyancy
+energy_tol = 1e-2
+
+failed = False
+
+def load(path):
+    return np.atleast_2d(np.loadtxt(path, comments = '#'))
+
+# Accuracy of energies
+for prefix in ['temperature', 'kinetic']:
+    fname = prefix + '_energy.dat'
+    ref = load(ref_dir + '/' + fname)
+    data = load(data_dir + '/' + fname)
+    n = min(ref.shape[0], data.shape[0])
+    if n == 0:
+        print(f'{fname}: no common rows')
+        failed = True
+        continue
+    if not np.all(np.isfinite(data[:n,1:])):
+        print(f'{fname}: energy is not finite')
+        failed = True
+        continue
+    scale = np.maximum(np.abs(ref[:n,1:]), np.finfo(float).tiny)
+    err = np.max(np.abs(data[:n,1:] - ref[:n,1:])/scale)
+    status = 'passed' if err <= energy_tol else 'failed'
+    print(f'{fname:24s} rows: {n:5d}  max relative deviation: {err:.3e}  {status}')
+    failed = failed or err > energy_tol
+
+# Timestep
+data = load(data_dir + '/cfl.dat')
+dt = data[:,1]
+status = 'passed' if np.all(dt > 0) else 'failed'
+print(f'{"cfl.dat":24s} dt: min {dt.min():.3e}  max {dt.max():.3e}  {status}')
+failed = failed or not np.all(dt > 0)
+
+if failed:
+    sys.exit(1)